@@ -14,11 +14,16 @@
 #include "daw_writable_output_fwd.h"
 
 #include <daw/daw_algorithm.h>
+#include <daw/daw_attributes.h>
 #include <daw/daw_character_traits.h>
+#include <daw/daw_likely.h>
 #include <daw/daw_string_view.h>
 
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <iostream>
+#include <memory>
 #include <string>
 
 namespace daw::json {
@@ -194,6 +199,288 @@ namespace daw::json {
 				}
 			};
 
+			/// @brief A caller owned buffer of fixed capacity.  Unlike the span
+			/// and pointer outputs, writing past the end is not an error.  The
+			/// output that fits is kept and the total size needed is tracked so
+			/// that truncation can be detected and the buffer resized
+			template<typename CharT = char>
+			struct bounded_output {
+				static_assert(
+				  writeable_output_details::is_char_sized_character_v<CharT> or
+				    writeable_output_details::is_byte_type_v<CharT>,
+				  "Only character sized types are supported" );
+				using value_type = CharT;
+
+			private:
+				CharT *m_data = nullptr;
+				std::size_t m_capacity = 0;
+				std::size_t m_required = 0;
+
+			public:
+				bounded_output( ) = default;
+
+				constexpr bounded_output( CharT *buffer, std::size_t capacity,
+				                          std::size_t used = 0 ) noexcept
+				  : m_data( buffer )
+				  , m_capacity( capacity )
+				  , m_required( used ) {}
+
+				template<typename Span,
+				         std::enable_if_t<
+				           writeable_output_details::is_span_like_range_v<Span, CharT>,
+				           std::nullptr_t> = nullptr>
+				explicit constexpr bounded_output( Span &buffer ) noexcept
+				  : m_data( buffer.data( ) )
+				  , m_capacity( buffer.size( ) ) {}
+
+				/// @brief Start of the buffer
+				[[nodiscard]] constexpr CharT *data( ) const noexcept {
+					return m_data;
+				}
+
+				/// @brief Number of characters written to the buffer
+				[[nodiscard]] constexpr std::size_t size( ) const noexcept {
+					return m_required < m_capacity ? m_required : m_capacity;
+				}
+
+				[[nodiscard]] constexpr std::size_t capacity( ) const noexcept {
+					return m_capacity;
+				}
+
+				/// @brief Number of characters the full output needs.  When larger
+				/// than capacity( ), the output was truncated
+				[[nodiscard]] constexpr std::size_t required_size( ) const noexcept {
+					return m_required;
+				}
+
+				[[nodiscard]] constexpr bool truncated( ) const noexcept {
+					return m_required > m_capacity;
+				}
+
+				constexpr void append( daw::string_view sv ) noexcept {
+					if( m_required < m_capacity ) {
+						auto const avail = m_capacity - m_required;
+						if( sv.size( ) <= avail ) {
+							(void)writeable_output_details::copy_to_buffer(
+							  m_data + m_required, sv );
+						} else {
+							(void)writeable_output_details::copy_to_buffer(
+							  m_data + m_required, daw::string_view( sv.data( ), avail ) );
+						}
+					}
+					m_required += sv.size( );
+				}
+
+				constexpr void push_back( char c ) noexcept {
+					if( m_required < m_capacity ) {
+						m_data[m_required] = static_cast<CharT>( c );
+					}
+					++m_required;
+				}
+			};
+
+			/// @brief Specialization for bounded_output, overflow is recorded and
+			/// not an error
+			template<typename CharT>
+			struct writable_output_trait<bounded_output<CharT>> : std::true_type {
+				template<typename... StringViews>
+				static constexpr void write( bounded_output<CharT> &out,
+				                             StringViews const &...svs ) {
+					static_assert( sizeof...( StringViews ) > 0 );
+					(void)( ( out.append( daw::string_view( svs ) ), 0 ) | ... );
+				}
+
+				static constexpr void put( bounded_output<CharT> &out, char c ) {
+					out.push_back( c );
+				}
+			};
+
+			/// @brief An output buffer that stores up to InlineCapacity characters
+			/// in itself and only allocates when the output grows past that.  This
+			/// allows short documents to be serialized without a heap allocation
+			template<std::size_t InlineCapacity = 512, typename CharT = char>
+			struct small_buffer_output {
+				static_assert( InlineCapacity > 0 );
+				static_assert(
+				  writeable_output_details::is_char_sized_character_v<CharT> or
+				    writeable_output_details::is_byte_type_v<CharT>,
+				  "Only character sized types are supported" );
+				using value_type = CharT;
+				static constexpr std::size_t inline_capacity = InlineCapacity;
+
+			private:
+				std::unique_ptr<CharT[]> m_heap = nullptr;
+				CharT *m_data = m_buffer;
+				std::size_t m_size = 0;
+				std::size_t m_capacity = InlineCapacity;
+				CharT m_buffer[InlineCapacity];
+
+				void assign( CharT const *first, std::size_t count ) {
+					if( count > InlineCapacity ) {
+						m_heap = std::unique_ptr<CharT[]>( new CharT[count] );
+						m_data = m_heap.get( );
+						m_capacity = count;
+					}
+					if( count > 0 ) {
+						std::memcpy( m_data, first, count );
+					}
+					m_size = count;
+				}
+
+				DAW_ATTRIB_NOINLINE void grow( std::size_t min_capacity ) {
+					auto const new_capacity = (std::max)( min_capacity, m_capacity * 2 );
+					auto new_heap = std::unique_ptr<CharT[]>( new CharT[new_capacity] );
+					std::memcpy( new_heap.get( ), m_data, m_size );
+					m_heap = std::move( new_heap );
+					m_data = m_heap.get( );
+					m_capacity = new_capacity;
+				}
+
+			public:
+				small_buffer_output( ) = default;
+
+				small_buffer_output( small_buffer_output const &other ) {
+					assign( other.m_data, other.m_size );
+				}
+
+				small_buffer_output( small_buffer_output &&other ) noexcept {
+					if( other.is_inline( ) ) {
+						assign( other.m_data, other.m_size );
+					} else {
+						m_heap = std::move( other.m_heap );
+						m_data = m_heap.get( );
+						m_size = other.m_size;
+						m_capacity = other.m_capacity;
+						other.m_data = other.m_buffer;
+						other.m_capacity = InlineCapacity;
+					}
+					other.m_size = 0;
+				}
+
+				small_buffer_output &operator=( small_buffer_output const &rhs ) {
+					if( this != &rhs ) {
+						clear( );
+						append( daw::string_view( rhs.m_data, rhs.m_size ) );
+					}
+					return *this;
+				}
+
+				small_buffer_output &operator=( small_buffer_output &&rhs ) noexcept {
+					if( this != &rhs ) {
+						if( rhs.is_inline( ) ) {
+							// Only the inline buffer is large enough to never allocate
+							m_heap.reset( );
+							m_data = m_buffer;
+							m_capacity = InlineCapacity;
+							assign( rhs.m_data, rhs.m_size );
+						} else {
+							m_heap = std::move( rhs.m_heap );
+							m_data = m_heap.get( );
+							m_size = rhs.m_size;
+							m_capacity = rhs.m_capacity;
+							rhs.m_data = rhs.m_buffer;
+							rhs.m_capacity = InlineCapacity;
+						}
+						rhs.m_size = 0;
+					}
+					return *this;
+				}
+
+				~small_buffer_output( ) = default;
+
+				[[nodiscard]] CharT *data( ) noexcept {
+					return m_data;
+				}
+
+				[[nodiscard]] CharT const *data( ) const noexcept {
+					return m_data;
+				}
+
+				[[nodiscard]] std::size_t size( ) const noexcept {
+					return m_size;
+				}
+
+				[[nodiscard]] bool empty( ) const noexcept {
+					return m_size == 0;
+				}
+
+				[[nodiscard]] std::size_t capacity( ) const noexcept {
+					return m_capacity;
+				}
+
+				/// @brief Is the output still stored in the inline buffer
+				[[nodiscard]] bool is_inline( ) const noexcept {
+					return m_data == m_buffer;
+				}
+
+				[[nodiscard]] CharT *begin( ) noexcept {
+					return m_data;
+				}
+
+				[[nodiscard]] CharT const *begin( ) const noexcept {
+					return m_data;
+				}
+
+				[[nodiscard]] CharT *end( ) noexcept {
+					return m_data + m_size;
+				}
+
+				[[nodiscard]] CharT const *end( ) const noexcept {
+					return m_data + m_size;
+				}
+
+				/// @brief Remove the contents but keep the capacity
+				void clear( ) noexcept {
+					m_size = 0;
+				}
+
+				void reserve( std::size_t new_capacity ) {
+					if( new_capacity > m_capacity ) {
+						grow( new_capacity );
+					}
+				}
+
+				DAW_ATTRIB_INLINE void append( daw::string_view sv ) {
+					if( DAW_UNLIKELY( m_capacity - m_size < sv.size( ) ) ) {
+						grow( m_size + sv.size( ) );
+					}
+					if( not sv.empty( ) ) {
+						std::memcpy( m_data + m_size, sv.data( ), sv.size( ) );
+						m_size += sv.size( );
+					}
+				}
+
+				DAW_ATTRIB_INLINE void push_back( char c ) {
+					if( DAW_UNLIKELY( m_size == m_capacity ) ) {
+						grow( m_size + 1 );
+					}
+					m_data[m_size++] = static_cast<CharT>( c );
+				}
+			};
+
+			/// @brief Specialization for small_buffer_output.  The total size of
+			/// each write is checked once
+			template<std::size_t InlineCapacity, typename CharT>
+			struct writable_output_trait<small_buffer_output<InlineCapacity, CharT>>
+			  : std::true_type {
+				using output_t = small_buffer_output<InlineCapacity, CharT>;
+
+				template<typename... StringViews>
+				static inline void write( output_t &out, StringViews const &...svs ) {
+					static_assert( sizeof...( StringViews ) > 0 );
+					if constexpr( sizeof...( StringViews ) == 1 ) {
+						(void)( out.append( daw::string_view( svs ) ), ... );
+					} else {
+						out.reserve( out.size( ) + ( std::size( svs ) + ... ) );
+						(void)( ( out.append( daw::string_view( svs ) ), 0 ) | ... );
+					}
+				}
+
+				static inline void put( output_t &out, char c ) {
+					out.push_back( c );
+				}
+			};
+
 			namespace writeable_output_details {
 				template<typename T, typename CharT>
 				using resizable_contiguous_range_test =
@@ -288,5 +575,8 @@ namespace daw::json {
 				}
 			};
 		} // namespace concepts
-	}   // namespace DAW_JSON_VER
+
+		using concepts::bounded_output;
+		using concepts::small_buffer_output;
+	} // namespace DAW_JSON_VER
 } // namespace daw::json
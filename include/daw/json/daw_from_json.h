@@ -12,6 +12,7 @@
 
 #include "daw_from_json_fwd.h"
 #include "impl/daw_json_parse_class.h"
+#include "impl/daw_json_parse_into.h"
 #include "impl/daw_json_parse_value.h"
 #include "impl/daw_json_value.h"
 
@@ -51,10 +52,15 @@ namespace daw::json {
 			using ParsePolicy =
 			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
 
+			static_assert(
+			  json_details::is_valid_unescape_in_place_buffer_v<ParsePolicy, String>,
+			  "UnescapeInPlace requires a JSON buffer that outlives the result" );
+
 			/// If the string is known to have a trailing zero, allow optimization on
 			/// that
 			using policy_zstring_t = json_details::apply_zstring_policy_option_t<
-			  ParsePolicy, String, options::ZeroTerminatedString::yes>;
+			  json_details::apply_unescape_in_place_policy_t<ParsePolicy, String>,
+			  String, options::ZeroTerminatedString::yes>;
 
 			/// In cases where we own the buffer or when requested and can, allow
 			/// temporarily mutating it to reduce search costs
@@ -126,17 +132,22 @@ namespace daw::json {
 			  "Missing specialization of daw::json::json_data_contract for class "
 			  "mapping or specialization of daw::json::json_link_basic_type_map" );
 
-			char const *f = std::data( json_data );
-			char const *l = daw::data_end( json_data );
+			auto *f = std::data( json_data );
+			auto *l = daw::data_end( json_data );
 			Allocator a = alloc;
 
 			using ParsePolicy =
 			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
 
+			static_assert(
+			  json_details::is_valid_unescape_in_place_buffer_v<ParsePolicy, String>,
+			  "UnescapeInPlace requires a JSON buffer that outlives the result" );
+
 			/// @brief If the string is known to have a trailing zero, allow
 			/// optimization on that
 			using policy_zstring_t = json_details::apply_zstring_policy_option_t<
-			  ParsePolicy, String, options::ZeroTerminatedString::yes>;
+			  json_details::apply_unescape_in_place_policy_t<ParsePolicy, String>,
+			  String, options::ZeroTerminatedString::yes>;
 
 			/// @brief In cases where we own the buffer or when requested and can,
 			/// allow temporarily mutating it to reduce search costs
@@ -177,6 +188,104 @@ namespace daw::json {
 			  DAW_FWD( json_data ), alloc, options::parse_flags<> );
 		}
 
+		/// @brief Parse the JSON document into an existing value.  Classes whose
+		/// to_json_data returns mutable references to their members are filled
+		/// in place.  Strings and containers are refilled and keep their
+		/// capacity, see reuse_constructor, and other values, including the
+		/// elements of containers, are assigned
+		/// @tparam JsonMember The mapping of T, deduced from T by default
+		/// @param value The value to parse into
+		/// @param json_data JSON string data
+		/// @throws daw::json::json_exception
+		template<typename JsonMember = use_default, bool KnownBounds = false,
+		         typename T, typename String, auto... PolicyFlags>
+		constexpr void from_json_into( T &value, String &&json_data,
+		                               options::parse_flags_t<PolicyFlags...> ) {
+			static_assert(
+			  json_details::is_string_view_like_v<String>,
+			  "String type must have a be a contiguous range of Characters" );
+			daw_json_ensure( std::data( json_data ) != nullptr,
+			                 ErrorReason::EmptyJSONPath );
+			daw_json_ensure( std::size( json_data ) != 0,
+			                 ErrorReason::EmptyJSONDocument );
+
+			using json_member = json_details::json_deduced_type<
+			  std::conditional_t<std::is_same_v<JsonMember, use_default>, T,
+			                     JsonMember>>;
+			static_assert( std::is_same_v<json_details::json_result<json_member>, T>,
+			               "The mapping must parse to the type of value" );
+			using ParsePolicy =
+			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
+
+			static_assert(
+			  json_details::is_valid_unescape_in_place_buffer_v<ParsePolicy, String>,
+			  "UnescapeInPlace requires a JSON buffer that outlives the result" );
+
+			using policy_zstring_t = json_details::apply_zstring_policy_option_t<
+			  json_details::apply_unescape_in_place_policy_t<ParsePolicy, String>,
+			  String, options::ZeroTerminatedString::yes>;
+
+			using ParseState =
+			  std::conditional_t<policy_zstring_t::is_default_parse_policy,
+			                     DefaultParsePolicy, policy_zstring_t>;
+			auto parse_state =
+			  ParseState( std::data( json_data ), daw::data_end( json_data ) );
+
+			json_details::parse_value_into<json_member, KnownBounds>( parse_state,
+			                                                          value );
+			if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
+				parse_state.trim_left( );
+				daw_json_ensure( parse_state.empty( ), ErrorReason::InvalidEndOfValue,
+				                 parse_state );
+			}
+		}
+
+		/// @brief Parse the JSON document into an existing value, see the
+		/// overload with parse flags
+		/// @param value The value to parse into
+		/// @param json_data JSON string data
+		/// @throws daw::json::json_exception
+		template<typename JsonMember = use_default, bool KnownBounds = false,
+		         typename T, typename String>
+		constexpr void from_json_into( T &value, String &&json_data ) {
+			from_json_into<JsonMember, KnownBounds>( value, DAW_FWD( json_data ),
+			                                         options::parse_flags<> );
+		}
+
+		/// @brief Construct the JSONMember from the JSON document argument,
+		/// interning the interned_string members in pool
+		/// @tparam JsonMember any bool, arithmetic, string, string_view,
+		/// daw::json::json_data_contract
+		/// @param json_data JSON string data
+		/// @param pool The string_pool to intern strings in.  It must outlive the
+		/// result
+		/// @return A reified T constructed from JSON data
+		/// @throws daw::json::json_exception
+		template<typename JsonMember, bool KnownBounds = false, typename String,
+		         auto... PolicyFlags>
+		[[nodiscard]] auto
+		from_json_interned( String &&json_data, string_pool &pool,
+		                    options::parse_flags_t<PolicyFlags...> flags ) {
+			return from_json_alloc<JsonMember, KnownBounds>(
+			  DAW_FWD( json_data ), pool.get_allocator( ), flags );
+		}
+
+		/// @brief Construct the JSONMember from the JSON document argument,
+		/// interning the interned_string members in pool
+		/// @tparam JsonMember any bool, arithmetic, string, string_view,
+		/// daw::json::json_data_contract
+		/// @param json_data JSON string data
+		/// @param pool The string_pool to intern strings in.  It must outlive the
+		/// result
+		/// @return A reified T constructed from JSON data
+		/// @throws daw::json::json_exception
+		template<typename JsonMember, bool KnownBounds = false, typename String>
+		[[nodiscard]] auto from_json_interned( String &&json_data,
+		                                       string_pool &pool ) {
+			return from_json_interned<JsonMember, KnownBounds>(
+			  DAW_FWD( json_data ), pool, options::parse_flags<> );
+		}
+
 		/// @brief Parse a JSONMember from the json_data starting at member_path.
 		/// @tparam JsonMember The type of the item being parsed
 		/// @param json_data JSON string data
@@ -212,10 +321,15 @@ namespace daw::json {
 			using ParsePolicy =
 			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
 
+			static_assert(
+			  json_details::is_valid_unescape_in_place_buffer_v<ParsePolicy, String>,
+			  "UnescapeInPlace requires a JSON buffer that outlives the result" );
+
 			/// @brief If the string is known to have a trailing zero, allow
 			/// optimization on that
 			using policy_zstring_t = json_details::apply_zstring_policy_option_t<
-			  ParsePolicy, String, options::ZeroTerminatedString::yes>;
+			  json_details::apply_unescape_in_place_policy_t<ParsePolicy, String>,
+			  String, options::ZeroTerminatedString::yes>;
 
 			/// @brief In cases where we own the buffer or when requested and can,
 			/// allow temporarily mutating it to reduce search costs
@@ -308,10 +422,15 @@ namespace daw::json {
 			using ParsePolicy =
 			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
 
+			static_assert(
+			  json_details::is_valid_unescape_in_place_buffer_v<ParsePolicy, String>,
+			  "UnescapeInPlace requires a JSON buffer that outlives the result" );
+
 			/// @brief If the string is known to have a trailing zero, allow
 			/// optimization on that
 			using policy_zstring_t = json_details::apply_zstring_policy_option_t<
-			  ParsePolicy, String, options::ZeroTerminatedString::yes>;
+			  json_details::apply_unescape_in_place_policy_t<ParsePolicy, String>,
+			  String, options::ZeroTerminatedString::yes>;
 
 			/// @brief In cases where we own the buffer or when requested and can,
 			/// allow temporarily mutating it to reduce search costs
@@ -521,10 +640,15 @@ namespace daw::json {
 			using ParsePolicy =
 			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
 
+			static_assert(
+			  json_details::is_valid_unescape_in_place_buffer_v<ParsePolicy, String>,
+			  "UnescapeInPlace requires a JSON buffer that outlives the result" );
+
 			/// @brief If the string is known to have a trailing zero, allow
 			/// optimization on that
 			using policy_zstring_t = json_details::apply_zstring_policy_option_t<
-			  ParsePolicy, String, options::ZeroTerminatedString::yes>;
+			  json_details::apply_unescape_in_place_policy_t<ParsePolicy, String>,
+			  String, options::ZeroTerminatedString::yes>;
 
 			/// @brief In cases where we own the buffer or when requested and can,
 			/// allow temporarily mutating it to reduce search costs
@@ -578,6 +702,90 @@ namespace daw::json {
 			  DAW_FWD( json_data ), options::parse_flags<> );
 		}
 
+		/// @brief Parse JSON data where the root item is an array of numbers
+		/// into a caller owned buffer, without allocating
+		/// @tparam JsonElement The mapping of each number, deduced from T by
+		/// default
+		/// @param buffer Start of the buffer the numbers are written to
+		/// @param capacity The number of elements buffer can hold
+		/// @param json_data JSON string data containing array
+		/// @return The number of elements written to buffer
+		/// @throws daw::json::json_exception with
+		/// ErrorReason::ArrayCapacityExceeded when there are more than capacity
+		/// elements
+		template<typename JsonElement = use_default, typename T, typename String,
+		         auto... PolicyFlags>
+		constexpr std::size_t
+		from_json_array_into( T *buffer, std::size_t capacity,
+		                      String &&json_data,
+		                      options::parse_flags_t<PolicyFlags...> ) {
+			static_assert(
+			  json_details::is_string_view_like_v<String>,
+			  "String type must have a be a contiguous range of Characters" );
+			daw_json_ensure( std::size( json_data ) != 0,
+			                 ErrorReason::EmptyJSONDocument );
+			daw_json_ensure( std::data( json_data ) != nullptr,
+			                 ErrorReason::EmptyJSONPath );
+
+			using element_type = json_details::json_deduced_type<
+			  std::conditional_t<std::is_same_v<JsonElement, use_default>, T,
+			                     JsonElement>>;
+			static_assert( element_type::expected_type == JsonParseTypes::Real or
+			                 element_type::expected_type == JsonParseTypes::Signed or
+			                 element_type::expected_type ==
+			                   JsonParseTypes::Unsigned,
+			               "from_json_array_into requires a number element type" );
+			static_assert(
+			  std::is_same_v<json_details::json_result<element_type>, T>,
+			  "The element mapping must parse to the type of the buffer" );
+
+			using ParsePolicy =
+			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
+			using policy_zstring_t = json_details::apply_zstring_policy_option_t<
+			  ParsePolicy, String, options::ZeroTerminatedString::yes>;
+			using ParseState =
+			  std::conditional_t<policy_zstring_t::is_default_parse_policy,
+			                     DefaultParsePolicy, policy_zstring_t>;
+			auto parse_state =
+			  ParseState{ std::data( json_data ), daw::data_end( json_data ) };
+
+			parse_state.trim_left_unchecked( );
+			daw_json_ensure( parse_state.is_opening_bracket_checked( ),
+			                 ErrorReason::InvalidArrayStart, parse_state );
+			parse_state.remove_prefix( );
+			parse_state.trim_left_unchecked( );
+
+			std::size_t count = 0;
+			json_details::parse_number_array_elements<element_type, false>(
+			  parse_state, [&]( T value ) {
+				  daw_json_ensure( count < capacity,
+				                   ErrorReason::ArrayCapacityExceeded, parse_state );
+				  buffer[count] = value;
+				  ++count;
+			  } );
+			if constexpr( ParseState::must_verify_end_of_data_is_valid ) {
+				parse_state.trim_left( );
+				daw_json_ensure( parse_state.empty( ), ErrorReason::InvalidEndOfValue,
+				                 parse_state );
+			}
+			return count;
+		}
+
+		/// @brief Parse JSON data where the root item is an array of numbers
+		/// into a caller owned buffer, see the overload with parse flags
+		/// @param buffer Start of the buffer the numbers are written to
+		/// @param capacity The number of elements buffer can hold
+		/// @param json_data JSON string data containing array
+		/// @return The number of elements written to buffer
+		/// @throws daw::json::json_exception
+		template<typename JsonElement = use_default, typename T, typename String>
+		constexpr std::size_t from_json_array_into( T *buffer,
+		                                            std::size_t capacity,
+		                                            String &&json_data ) {
+			return from_json_array_into<JsonElement>(
+			  buffer, capacity, DAW_FWD( json_data ), options::parse_flags<> );
+		}
+
 		/// @brief Parse JSON data where the root item is an array
 		/// @tparam JsonElement The type of each element in array.  Must be one of
 		/// the above json_XXX classes.  This version is checked
@@ -620,10 +828,15 @@ namespace daw::json {
 			using ParsePolicy =
 			  BasicParsePolicy<options::parse_flags_t<PolicyFlags...>::value>;
 
+			static_assert(
+			  json_details::is_valid_unescape_in_place_buffer_v<ParsePolicy, String>,
+			  "UnescapeInPlace requires a JSON buffer that outlives the result" );
+
 			/// @brief If the string is known to have a trailing zero, allow
 			/// optimization on that
 			using policy_zstring_t = json_details::apply_zstring_policy_option_t<
-			  ParsePolicy, String, options::ZeroTerminatedString::yes>;
+			  json_details::apply_unescape_in_place_policy_t<ParsePolicy, String>,
+			  String, options::ZeroTerminatedString::yes>;
 
 			/// @brief In cases where we own the buffer or when requested and can,
 			/// allow temporarily mutating it to reduce search costs
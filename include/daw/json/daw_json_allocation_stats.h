@@ -0,0 +1,342 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "concepts/daw_writable_output.h"
+
+#include <daw/daw_traits.h>
+
+#include <ciso646>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/// @brief The name of T as the compiler spells it, for reporting
+			template<typename T>
+			[[nodiscard]] std::string_view allocated_type_name( ) noexcept {
+#if defined( __clang__ ) or defined( __GNUC__ )
+				auto const name = std::string_view( __PRETTY_FUNCTION__ );
+				auto const first = name.find( "T = " );
+				if( first == std::string_view::npos ) {
+					return name;
+				}
+				auto const last = name.find_first_of( ";]", first + 4U );
+				return name.substr( first + 4U, last - ( first + 4U ) );
+#elif defined( _MSC_VER )
+				auto const name = std::string_view( __FUNCSIG__ );
+				auto const first = name.find( "allocated_type_name<" );
+				auto const last = name.rfind( ">(void)" );
+				if( first == std::string_view::npos or
+				    last == std::string_view::npos ) {
+					return name;
+				}
+				return name.substr( first + 20U, last - ( first + 20U ) );
+#else
+				return "unknown";
+#endif
+			}
+
+			template<typename T>
+			inline constexpr char allocated_type_tag = 0;
+		} // namespace json_details
+
+		/***
+		 * Allocation counters.  Bytes are the sizes requested from the
+		 * allocator, not including any overhead of the allocator itself
+		 */
+		struct allocation_counts {
+			std::size_t allocations = 0;
+			std::size_t deallocations = 0;
+			std::size_t bytes_allocated = 0;
+			std::size_t bytes_deallocated = 0;
+
+			[[nodiscard]] constexpr std::size_t bytes_in_use( ) const noexcept {
+				return bytes_allocated - bytes_deallocated;
+			}
+		};
+
+		/// @brief The allocation counters of one allocated type
+		struct allocation_type_counts {
+			void const *tag = nullptr;
+			std::string_view type_name{ };
+			allocation_counts counts{ };
+		};
+
+		/***
+		 * The allocations made through counting_allocator, in total and by the
+		 * type allocated.  A std::vector<Foo> counts its buffers under Foo and
+		 * a std::string under char.  Not thread safe.
+		 */
+		class allocation_stats {
+			allocation_counts m_total{ };
+			std::size_t m_peak_bytes = 0;
+			std::vector<allocation_type_counts> m_by_type{ };
+
+			[[nodiscard]] allocation_type_counts *
+			find( void const *tag ) noexcept {
+				for( auto &e : m_by_type ) {
+					if( e.tag == tag ) {
+						return &e;
+					}
+				}
+				return nullptr;
+			}
+
+			[[nodiscard]] allocation_type_counts const *
+			find( void const *tag ) const noexcept {
+				for( auto const &e : m_by_type ) {
+					if( e.tag == tag ) {
+						return &e;
+					}
+				}
+				return nullptr;
+			}
+
+		public:
+			template<typename T>
+			void record_allocation( std::size_t bytes ) {
+				void const *const tag = &json_details::allocated_type_tag<T>;
+				auto *e = find( tag );
+				if( e == nullptr ) {
+					m_by_type.push_back( allocation_type_counts{
+					  tag, json_details::allocated_type_name<T>( ), { } } );
+					e = &m_by_type.back( );
+				}
+				++e->counts.allocations;
+				e->counts.bytes_allocated += bytes;
+				++m_total.allocations;
+				m_total.bytes_allocated += bytes;
+				if( m_total.bytes_in_use( ) > m_peak_bytes ) {
+					m_peak_bytes = m_total.bytes_in_use( );
+				}
+			}
+
+			template<typename T>
+			void record_deallocation( std::size_t bytes ) noexcept {
+				if( auto *e = find( &json_details::allocated_type_tag<T> );
+				    e != nullptr ) {
+					++e->counts.deallocations;
+					e->counts.bytes_deallocated += bytes;
+				}
+				++m_total.deallocations;
+				m_total.bytes_deallocated += bytes;
+			}
+
+			[[nodiscard]] allocation_counts const &total( ) const noexcept {
+				return m_total;
+			}
+
+			/// @brief The largest number of bytes in use at once
+			[[nodiscard]] std::size_t peak_bytes( ) const noexcept {
+				return m_peak_bytes;
+			}
+
+			/// @brief The counters of each type allocated, in the order they were
+			/// first allocated
+			[[nodiscard]] std::vector<allocation_type_counts> const &
+			by_type( ) const noexcept {
+				return m_by_type;
+			}
+
+			/// @brief The counters of allocations of T
+			template<typename T>
+			[[nodiscard]] allocation_counts for_type( ) const noexcept {
+				if( auto const *e = find( &json_details::allocated_type_tag<T> );
+				    e != nullptr ) {
+					return e->counts;
+				}
+				return { };
+			}
+
+			void reset( ) noexcept {
+				m_total = allocation_counts{ };
+				m_peak_bytes = 0;
+				m_by_type.clear( );
+			}
+		};
+
+		/***
+		 * An allocator adaptor that records the allocations of Alloc in an
+		 * allocation_stats.  Passing it to from_json_alloc counts the
+		 * allocations of the members that use it, e.g.
+		 * std::vector<int, counting_allocator<int>>, as the parse allocator is
+		 * rebound to each member.  The stats must outlive the allocator and
+		 * everything allocated with it
+		 */
+		template<typename T, typename Alloc = std::allocator<T>>
+		class counting_allocator {
+			static_assert(
+			  std::is_same_v<T, typename std::allocator_traits<Alloc>::value_type>,
+			  "The upstream allocator must allocate T" );
+
+			using traits_t = std::allocator_traits<Alloc>;
+
+			Alloc m_alloc;
+			allocation_stats *m_stats;
+
+		public:
+			using value_type = T;
+			using upstream_allocator_type = Alloc;
+			using propagate_on_container_copy_assignment = std::true_type;
+			using propagate_on_container_move_assignment = std::true_type;
+			using propagate_on_container_swap = std::true_type;
+			using is_always_equal = std::false_type;
+
+			template<typename U>
+			struct rebind {
+				using other =
+				  counting_allocator<U, typename traits_t::template rebind_alloc<U>>;
+			};
+
+			explicit counting_allocator( allocation_stats &stats,
+			                             Alloc const &alloc = Alloc( ) )
+			  : m_alloc( alloc )
+			  , m_stats( &stats ) {}
+
+			template<typename U, typename A>
+			counting_allocator( counting_allocator<U, A> const &other )
+			  : m_alloc( other.upstream( ) )
+			  , m_stats( &other.stats( ) ) {}
+
+			[[nodiscard]] T *allocate( std::size_t n ) {
+				T *const result = traits_t::allocate( m_alloc, n );
+				m_stats->template record_allocation<T>( n * sizeof( T ) );
+				return result;
+			}
+
+			void deallocate( T *p, std::size_t n ) noexcept {
+				m_stats->template record_deallocation<T>( n * sizeof( T ) );
+				traits_t::deallocate( m_alloc, p, n );
+			}
+
+			[[nodiscard]] allocation_stats &stats( ) const noexcept {
+				return *m_stats;
+			}
+
+			[[nodiscard]] Alloc const &upstream( ) const noexcept {
+				return m_alloc;
+			}
+
+			template<typename U, typename A>
+			[[nodiscard]] friend bool
+			operator==( counting_allocator const &lhs,
+			            counting_allocator<U, A> const &rhs ) noexcept {
+				return &lhs.stats( ) == &rhs.stats( ) and
+				       lhs.upstream( ) == rhs.upstream( );
+			}
+
+			template<typename U, typename A>
+			[[nodiscard]] friend bool
+			operator!=( counting_allocator const &lhs,
+			            counting_allocator<U, A> const &rhs ) noexcept {
+				return not( lhs == rhs );
+			}
+		};
+
+		/***
+		 * Counters for serializing through a counting_output.  growths is the
+		 * number of writes that increased the capacity of the output, it is only
+		 * tracked for outputs with a capacity( ) member
+		 */
+		struct output_stats {
+			std::size_t writes = 0;
+			std::size_t bytes_written = 0;
+			std::size_t growths = 0;
+			std::size_t capacity = 0;
+		};
+
+		namespace json_details {
+			template<typename T>
+			using has_capacity_test =
+			  decltype( std::declval<T const &>( ).capacity( ) );
+
+			template<typename T>
+			[[nodiscard]] std::size_t output_capacity( T const &out ) {
+				if constexpr( daw::is_detected_v<has_capacity_test, T> ) {
+					return static_cast<std::size_t>( out.capacity( ) );
+				} else {
+					(void)out;
+					return 0;
+				}
+			}
+		} // namespace json_details
+
+		/***
+		 * A writable output that passes everything to WritableOutput and counts
+		 * the writes, the bytes and the growths of it in an output_stats.
+		 * e.g. to_json( value, counting_output( str, stats ) )
+		 */
+		template<typename WritableOutput>
+		class counting_output {
+			static_assert( concepts::is_writable_output_type_v<WritableOutput>,
+			               "counting_output requires a writable output" );
+
+			WritableOutput *m_out;
+			output_stats *m_stats;
+
+		public:
+			using output_type = WritableOutput;
+
+			counting_output( WritableOutput &out, output_stats &stats )
+			  : m_out( &out )
+			  , m_stats( &stats ) {
+				m_stats->capacity = json_details::output_capacity( out );
+			}
+
+			[[nodiscard]] WritableOutput &get( ) const noexcept {
+				return *m_out;
+			}
+
+			[[nodiscard]] output_stats &stats( ) const noexcept {
+				return *m_stats;
+			}
+		};
+
+		namespace concepts {
+			template<typename WritableOutput>
+			struct writable_output_trait<counting_output<WritableOutput>>
+			  : std::true_type {
+				using output_trait_t = writable_output_trait<WritableOutput>;
+
+				static inline void record( counting_output<WritableOutput> &out,
+				                           std::size_t bytes ) {
+					output_stats &stats = out.stats( );
+					++stats.writes;
+					stats.bytes_written += bytes;
+					auto const capacity = json_details::output_capacity( out.get( ) );
+					if( capacity > stats.capacity ) {
+						++stats.growths;
+					}
+					stats.capacity = capacity;
+				}
+
+				template<typename... StringViews>
+				static inline void write( counting_output<WritableOutput> &out,
+				                          StringViews const &...svs ) {
+					static_assert( sizeof...( StringViews ) > 0 );
+					output_trait_t::write( out.get( ), svs... );
+					record( out, ( std::size( svs ) + ... ) );
+				}
+
+				static inline void put( counting_output<WritableOutput> &out,
+				                        char c ) {
+					output_trait_t::put( out.get( ), c );
+					record( out, 1U );
+				}
+			};
+		} // namespace concepts
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
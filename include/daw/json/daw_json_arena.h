@@ -0,0 +1,228 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_from_json.h"
+
+#include <daw/daw_attributes.h>
+#include <daw/daw_move.h>
+
+#include <ciso646>
+#include <cstddef>
+#include <memory>
+
+#if __has_include( <memory_resource> )
+#include <memory_resource>
+#endif
+
+#if not defined( __cpp_lib_memory_resource )
+#error "daw_json_arena.h requires std::pmr from <memory_resource>"
+#endif
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * A monotonic memory resource for whole document parses.  Memory is bump
+		 * allocated from a chain of chunks obtained from the upstream resource
+		 * and deallocation is a no-op.  reset( ) makes all the memory available
+		 * again in O(1) while keeping the chunks for the next batch, release( )
+		 * returns the chunks to the upstream resource.
+		 * Values allocated from the arena must be destroyed, or no longer used,
+		 * before reset( ) or release( ) is called.  Not thread safe.
+		 */
+		class arena : public std::pmr::memory_resource {
+			struct chunk {
+				chunk *next;
+				std::size_t size;
+			};
+
+			static constexpr std::size_t chunk_alignment =
+			  alignof( std::max_align_t );
+			static constexpr std::size_t header_size =
+			  ( sizeof( chunk ) + chunk_alignment - 1 ) & ~( chunk_alignment - 1 );
+
+			std::pmr::memory_resource *m_upstream;
+			std::size_t m_initial_chunk_size;
+			std::size_t m_next_chunk_size = m_initial_chunk_size;
+			chunk *m_first = nullptr;
+			chunk *m_current = nullptr;
+			char *m_ptr = nullptr;
+			char *m_end = nullptr;
+			std::size_t m_used = 0;
+			std::size_t m_capacity = 0;
+
+			[[nodiscard]] static char *chunk_data( chunk *c ) noexcept {
+				return reinterpret_cast<char *>( c ) + header_size;
+			}
+
+			void use_chunk( chunk *c ) noexcept {
+				m_current = c;
+				m_ptr = chunk_data( c );
+				m_end = m_ptr + c->size;
+			}
+
+			[[nodiscard]] DAW_ATTRIB_INLINE void *bump( std::size_t bytes,
+			                                            std::size_t alignment ) {
+				void *p = m_ptr;
+				auto space = static_cast<std::size_t>( m_end - m_ptr );
+				if( std::align( alignment, bytes, p, space ) == nullptr ) {
+					return nullptr;
+				}
+				m_ptr = static_cast<char *>( p ) + bytes;
+				m_used += bytes;
+				return p;
+			}
+
+			DAW_ATTRIB_NOINLINE void *allocate_slow( std::size_t bytes,
+			                                         std::size_t alignment ) {
+				// Use the chunks kept by reset( ) before going upstream
+				while( m_current != nullptr and m_current->next != nullptr ) {
+					use_chunk( m_current->next );
+					if( void *p = bump( bytes, alignment ); p != nullptr ) {
+						return p;
+					}
+				}
+				std::size_t const needed = bytes + alignment;
+				std::size_t size = m_next_chunk_size;
+				if( size < needed ) {
+					size = needed;
+				} else {
+					m_next_chunk_size *= 2U;
+				}
+				auto *c = static_cast<chunk *>(
+				  m_upstream->allocate( header_size + size, chunk_alignment ) );
+				c->next = nullptr;
+				c->size = size;
+				m_capacity += size;
+				if( m_current == nullptr ) {
+					m_first = c;
+				} else {
+					m_current->next = c;
+				}
+				use_chunk( c );
+				return bump( bytes, alignment );
+			}
+
+		public:
+			static constexpr std::size_t default_chunk_size = 64U * 1024U;
+
+			explicit arena( std::size_t initial_chunk_size = default_chunk_size,
+			                std::pmr::memory_resource *upstream =
+			                  std::pmr::new_delete_resource( ) )
+			  : m_upstream( upstream )
+			  , m_initial_chunk_size( initial_chunk_size == 0 ? default_chunk_size
+			                                                  : initial_chunk_size ) {}
+
+			arena( arena const & ) = delete;
+			arena &operator=( arena const & ) = delete;
+
+			~arena( ) override {
+				release( );
+			}
+
+			/// @brief Make all the memory available again, keeping the chunks.
+			/// O(1)
+			void reset( ) noexcept {
+				m_used = 0;
+				if( m_first != nullptr ) {
+					use_chunk( m_first );
+				}
+			}
+
+			/// @brief Return all the chunks to the upstream resource
+			void release( ) noexcept {
+				chunk *c = m_first;
+				while( c != nullptr ) {
+					chunk *const next = c->next;
+					m_upstream->deallocate( c, header_size + c->size, chunk_alignment );
+					c = next;
+				}
+				m_first = nullptr;
+				m_current = nullptr;
+				m_ptr = nullptr;
+				m_end = nullptr;
+				m_used = 0;
+				m_capacity = 0;
+				m_next_chunk_size = m_initial_chunk_size;
+			}
+
+			/// @brief The number of bytes allocated since the last reset
+			[[nodiscard]] std::size_t bytes_used( ) const noexcept {
+				return m_used;
+			}
+
+			/// @brief The number of bytes held in chunks
+			[[nodiscard]] std::size_t capacity( ) const noexcept {
+				return m_capacity;
+			}
+
+			[[nodiscard]] std::pmr::memory_resource *
+			upstream_resource( ) const noexcept {
+				return m_upstream;
+			}
+
+		protected:
+			void *do_allocate( std::size_t bytes, std::size_t alignment ) override {
+				if( m_current != nullptr ) {
+					if( void *p = bump( bytes, alignment ); p != nullptr ) {
+						return p;
+					}
+				}
+				return allocate_slow( bytes, alignment );
+			}
+
+			void do_deallocate( void *, std::size_t, std::size_t ) override {}
+
+			[[nodiscard]] bool do_is_equal(
+			  std::pmr::memory_resource const &other ) const noexcept override {
+				return this == &other;
+			}
+		};
+
+		/***
+		 * Parse a JSON document with all allocations made from an arena.  The
+		 * allocator is a std::pmr::polymorphic_allocator, so the strings,
+		 * containers and maps in the mapped types must be the std::pmr ones (or
+		 * otherwise be constructible from a polymorphic_allocator) for their
+		 * memory to come from the arena.
+		 * @tparam JsonMember The type to parse, as with from_json
+		 * @tparam KnownBounds The bounds of the json_data are known to contain
+		 * the whole value
+		 * @param json_data JSON string data
+		 * @param mem The arena to allocate from.  It must outlive the result
+		 * @return A reified JsonMember constructed from the JSON data
+		 * @throws daw::json::json_exception
+		 */
+		template<typename JsonMember, bool KnownBounds = false, typename String,
+		         auto... PolicyFlags>
+		[[nodiscard]] auto
+		from_json_arena( String &&json_data, arena &mem,
+		                 options::parse_flags_t<PolicyFlags...> flags ) {
+			return from_json_alloc<JsonMember, KnownBounds>(
+			  DAW_FWD( json_data ), std::pmr::polymorphic_allocator<char>( &mem ),
+			  flags );
+		}
+
+		/***
+		 * Parse a JSON document with all allocations made from an arena
+		 * @tparam JsonMember The type to parse, as with from_json
+		 * @param json_data JSON string data
+		 * @param mem The arena to allocate from.  It must outlive the result
+		 * @return A reified JsonMember constructed from the JSON data
+		 * @throws daw::json::json_exception
+		 */
+		template<typename JsonMember, bool KnownBounds = false, typename String>
+		[[nodiscard]] auto from_json_arena( String &&json_data, arena &mem ) {
+			return from_json_arena<JsonMember, KnownBounds>(
+			  DAW_FWD( json_data ), mem, options::parse_flags<> );
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
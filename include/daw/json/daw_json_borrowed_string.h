@@ -0,0 +1,154 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include <daw/daw_attributes.h>
+#include <daw/daw_move.h>
+
+#include <ciso646>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * A string that refers to the JSON document when the JSON string has no
+		 * escapes and owns the decoded text when it does.  Mapping it with
+		 * json_string costs no allocation for strings without escapes.  Borrowed
+		 * strings are only valid while the JSON document is.
+		 * @tparam Allocator The allocator used for the decoded text of strings
+		 * with escapes
+		 */
+		template<typename Allocator = std::allocator<char>>
+		class basic_borrowed_string {
+		public:
+			using value_type = char;
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using const_pointer = char const *;
+			using pointer = const_pointer;
+			using const_iterator = char const *;
+			using iterator = const_iterator;
+			using allocator_type = Allocator;
+			using string_type =
+			  std::basic_string<char, std::char_traits<char>, Allocator>;
+
+		private:
+			string_type m_owned = string_type( );
+			char const *m_first = nullptr;
+			std::size_t m_size = 0;
+			bool m_is_owned = false;
+
+		public:
+			basic_borrowed_string( ) = default;
+
+			/// @brief Borrow the range [ptr, ptr + sz)
+			basic_borrowed_string( char const *ptr, std::size_t sz )
+			  : m_first( ptr )
+			  , m_size( sz ) {}
+
+			basic_borrowed_string( char const *ptr, std::size_t sz,
+			                       Allocator const &alloc )
+			  : m_owned( alloc )
+			  , m_first( ptr )
+			  , m_size( sz ) {}
+
+			/// @brief Borrow the range [first, last)
+			basic_borrowed_string( char const *first, char const *last )
+			  : m_first( first )
+			  , m_size( static_cast<std::size_t>( last - first ) ) {}
+
+			basic_borrowed_string( char const *first, char const *last,
+			                       Allocator const &alloc )
+			  : m_owned( alloc )
+			  , m_first( first )
+			  , m_size( static_cast<std::size_t>( last - first ) ) {}
+
+			/// @brief Own the decoded text
+			explicit basic_borrowed_string( string_type &&decoded )
+			  : m_owned( DAW_MOVE( decoded ) )
+			  , m_is_owned( true ) {}
+
+			basic_borrowed_string( string_type &&decoded, Allocator const &alloc )
+			  : m_owned( DAW_MOVE( decoded ), alloc )
+			  , m_is_owned( true ) {}
+
+			/// @brief True when the text is in the JSON document
+			[[nodiscard]] bool is_borrowed( ) const noexcept {
+				return not m_is_owned;
+			}
+
+			[[nodiscard]] char const *data( ) const noexcept {
+				return m_is_owned ? m_owned.data( ) : m_first;
+			}
+
+			[[nodiscard]] std::size_t size( ) const noexcept {
+				return m_is_owned ? m_owned.size( ) : m_size;
+			}
+
+			[[nodiscard]] bool empty( ) const noexcept {
+				return size( ) == 0;
+			}
+
+			[[nodiscard]] const_iterator begin( ) const noexcept {
+				return data( );
+			}
+
+			[[nodiscard]] const_iterator end( ) const noexcept {
+				return data( ) + size( );
+			}
+
+			[[nodiscard]] std::string_view view( ) const noexcept {
+				return std::string_view( data( ), size( ) );
+			}
+
+			[[nodiscard]] operator std::string_view( ) const noexcept {
+				return view( );
+			}
+
+			[[nodiscard]] friend bool
+			operator==( basic_borrowed_string const &lhs,
+			            basic_borrowed_string const &rhs ) noexcept {
+				return lhs.view( ) == rhs.view( );
+			}
+
+			[[nodiscard]] friend bool
+			operator!=( basic_borrowed_string const &lhs,
+			            basic_borrowed_string const &rhs ) noexcept {
+				return lhs.view( ) != rhs.view( );
+			}
+
+			[[nodiscard]] friend bool operator==( basic_borrowed_string const &lhs,
+			                                      std::string_view rhs ) noexcept {
+				return lhs.view( ) == rhs;
+			}
+
+			[[nodiscard]] friend bool operator!=( basic_borrowed_string const &lhs,
+			                                      std::string_view rhs ) noexcept {
+				return lhs.view( ) != rhs;
+			}
+		};
+
+		using borrowed_string = basic_borrowed_string<>;
+
+		namespace json_details {
+			template<typename>
+			inline constexpr bool is_borrowed_string_v = false;
+
+			template<typename Allocator>
+			inline constexpr bool
+			  is_borrowed_string_v<basic_borrowed_string<Allocator>> = true;
+		} // namespace json_details
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
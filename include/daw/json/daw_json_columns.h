@@ -0,0 +1,336 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "concepts/daw_nullable_value.h"
+#include "daw_from_json.h"
+#include "daw_json_data_contract.h"
+#include "daw_json_link_types.h"
+
+#include <daw/daw_move.h>
+
+#include <ciso646>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * The values of a member that is never null, one per record
+		 */
+		template<typename T>
+		class value_column {
+			std::vector<T> m_values{ };
+
+		public:
+			using value_type = T;
+
+			[[nodiscard]] std::size_t size( ) const noexcept {
+				return m_values.size( );
+			}
+
+			[[nodiscard]] bool empty( ) const noexcept {
+				return m_values.empty( );
+			}
+
+			[[nodiscard]] T const &operator[]( std::size_t index ) const {
+				return m_values[index];
+			}
+
+			/// @brief The values, contiguous in record order
+			[[nodiscard]] std::vector<T> const &values( ) const noexcept {
+				return m_values;
+			}
+
+			void reserve( std::size_t count ) {
+				m_values.reserve( count );
+			}
+
+			void push_back( T value ) {
+				m_values.push_back( DAW_MOVE( value ) );
+			}
+		};
+
+		/***
+		 * The values of a nullable member, one per record, and a validity bitmap.
+		 * Bit i % 64 of word i / 64 is set when record i has a value.  Null
+		 * records hold a value initialized T so that the values stay contiguous
+		 */
+		template<typename T>
+		class nullable_column {
+			static_assert( std::is_default_constructible_v<T>,
+			               "Nullable columns require a default constructible type" );
+
+			std::vector<T> m_values{ };
+			std::vector<std::uint64_t> m_validity{ };
+			std::size_t m_null_count = 0;
+
+			void append_bit( bool has_value ) {
+				std::size_t const index = m_values.size( );
+				if( index % 64U == 0 ) {
+					m_validity.push_back( 0U );
+				}
+				if( has_value ) {
+					m_validity.back( ) |= std::uint64_t{ 1U } << ( index % 64U );
+				} else {
+					++m_null_count;
+				}
+			}
+
+		public:
+			using value_type = T;
+
+			[[nodiscard]] std::size_t size( ) const noexcept {
+				return m_values.size( );
+			}
+
+			[[nodiscard]] bool empty( ) const noexcept {
+				return m_values.empty( );
+			}
+
+			/// @brief The value of record index, or a value initialized T when it is
+			/// null
+			[[nodiscard]] T const &operator[]( std::size_t index ) const {
+				return m_values[index];
+			}
+
+			[[nodiscard]] bool has_value( std::size_t index ) const {
+				return ( ( m_validity[index / 64U] >> ( index % 64U ) ) & 1U ) != 0;
+			}
+
+			[[nodiscard]] std::size_t null_count( ) const noexcept {
+				return m_null_count;
+			}
+
+			/// @brief The values, contiguous in record order
+			[[nodiscard]] std::vector<T> const &values( ) const noexcept {
+				return m_values;
+			}
+
+			/// @brief The validity bitmap, least significant bit first
+			[[nodiscard]] std::vector<std::uint64_t> const &
+			validity( ) const noexcept {
+				return m_validity;
+			}
+
+			void reserve( std::size_t count ) {
+				m_values.reserve( count );
+				m_validity.reserve( ( count + 63U ) / 64U );
+			}
+
+			void push_back( T value ) {
+				append_bit( true );
+				m_values.push_back( DAW_MOVE( value ) );
+			}
+
+			void push_null( ) {
+				append_bit( false );
+				m_values.emplace_back( );
+			}
+		};
+
+		namespace json_details {
+			template<typename JsonMember,
+			         bool IsNullable = is_json_nullable_v<JsonMember>>
+			struct column_for {
+				using type = value_column<json_result<JsonMember>>;
+
+				template<typename Value>
+				static void append( type &column, Value &&value ) {
+					column.push_back( DAW_FWD( value ) );
+				}
+			};
+
+			template<typename JsonMember>
+			struct column_for<JsonMember, true> {
+				using nullable_type = json_result<JsonMember>;
+				using type =
+				  nullable_column<concepts::nullable_value_type_t<nullable_type>>;
+
+				static void append( type &column, nullable_type const &value ) {
+					if( concepts::nullable_value_has_value( value ) ) {
+						column.push_back( concepts::nullable_value_read( value ) );
+					} else {
+						column.push_null( );
+					}
+				}
+			};
+
+			template<typename>
+			struct columns_of;
+
+			template<typename... JsonMembers>
+			struct columns_of<json_member_list<JsonMembers...>> {
+				using row_type = std::tuple<json_result<JsonMembers>...>;
+				using columns_type =
+				  std::tuple<typename column_for<JsonMembers>::type...>;
+
+				template<std::size_t... Is>
+				static void append( columns_type &columns, row_type &&row,
+				                    std::index_sequence<Is...> ) {
+					( column_for<JsonMembers>::append( std::get<Is>( columns ),
+					                                   std::get<Is>( DAW_MOVE( row ) ) ),
+					  ... );
+				}
+			};
+
+			template<typename Record>
+			using record_columns_of = columns_of<json_data_contract_trait_t<Record>>;
+
+			template<typename>
+			struct row_storage;
+
+			template<typename... Ts>
+			struct row_storage<std::tuple<Ts...>> {
+				std::tuple<Ts...> values;
+
+				row_storage( Ts... vs )
+				  : values( DAW_MOVE( vs )... ) {}
+			};
+		} // namespace json_details
+
+		/***
+		 * The values of one JSON object mapped by json_data_contract<Record>.
+		 * record_columns parses to it instead of to Record
+		 */
+		template<typename Record>
+		struct column_row
+		  : json_details::row_storage<
+		      typename json_details::record_columns_of<Record>::row_type> {
+			using base_type = json_details::row_storage<
+			  typename json_details::record_columns_of<Record>::row_type>;
+			using base_type::base_type;
+		};
+
+		template<typename Record>
+		struct json_data_contract<column_row<Record>> {
+			using type = json_data_contract_trait_t<Record>;
+		};
+
+		/***
+		 * An array of Record stored as one column per member of the
+		 * json_data_contract<Record> member list, in member order.  Nullable
+		 * members have a validity bitmap.  Record itself is never constructed
+		 */
+		template<typename Record>
+		class record_columns {
+			using columns_of_t = json_details::record_columns_of<Record>;
+
+		public:
+			using row_type = column_row<Record>;
+			using columns_type = typename columns_of_t::columns_type;
+			static constexpr std::size_t column_count =
+			  std::tuple_size_v<columns_type>;
+
+		private:
+			columns_type m_columns{ };
+			std::size_t m_size = 0;
+
+			template<std::size_t... Is>
+			void reserve_impl( std::size_t count, std::index_sequence<Is...> ) {
+				( std::get<Is>( m_columns ).reserve( count ), ... );
+			}
+
+		public:
+			record_columns( ) = default;
+
+			template<typename Iterator>
+			record_columns( Iterator first, Iterator last ) {
+				for( ; first != last; ++first ) {
+					push_back( *first );
+				}
+			}
+
+			/// @brief Construct with the columns sized for the number of records
+			/// counted before parsing
+			template<typename Iterator>
+			record_columns( Iterator first, Iterator last, std::size_t size_hint ) {
+				reserve( size_hint );
+				for( ; first != last; ++first ) {
+					push_back( *first );
+				}
+			}
+
+			[[nodiscard]] std::size_t size( ) const noexcept {
+				return m_size;
+			}
+
+			[[nodiscard]] bool empty( ) const noexcept {
+				return m_size == 0;
+			}
+
+			/// @brief The column of the member at Index in the member list
+			template<std::size_t Index>
+			[[nodiscard]] auto const &column( ) const noexcept {
+				static_assert( Index < column_count, "Invalid column index" );
+				return std::get<Index>( m_columns );
+			}
+
+			[[nodiscard]] columns_type const &columns( ) const noexcept {
+				return m_columns;
+			}
+
+			void reserve( std::size_t count ) {
+				reserve_impl( count, std::make_index_sequence<column_count>{ } );
+			}
+
+			void push_back( row_type row ) {
+				columns_of_t::append( m_columns, DAW_MOVE( row.values ),
+				                      std::make_index_sequence<column_count>{ } );
+				++m_size;
+			}
+		};
+
+		/***
+		 * Parse a JSON array of objects mapped by json_data_contract<Record>
+		 * into columns.  The records are counted before parsing so that each
+		 * column is allocated once, see options::PrecountArrays.  It is always
+		 * set and cannot be passed in the flags
+		 * @tparam Record A type with a json_member_list data contract
+		 * @param json_data JSON string data
+		 * @return The columns of the records, in document order
+		 * @throws daw::json::json_exception
+		 */
+		template<typename Record, typename String, auto... PolicyFlags>
+		[[nodiscard]] record_columns<Record>
+		from_json_columns( String &&json_data,
+		                   options::parse_flags_t<PolicyFlags...> ) {
+			static_assert(
+			  ( not std::is_same_v<decltype( PolicyFlags ),
+			                       options::PrecountArrays> and
+			    ... ),
+			  "from_json_columns always uses options::PrecountArrays::yes" );
+			return from_json<json_array_no_name<column_row<Record>,
+			                                    record_columns<Record>>>(
+			  DAW_FWD( json_data ),
+			  options::parse_flags<PolicyFlags..., options::PrecountArrays::yes> );
+		}
+
+		/***
+		 * Parse a JSON array of objects mapped by json_data_contract<Record>
+		 * into columns
+		 * @tparam Record A type with a json_member_list data contract
+		 * @param json_data JSON string data
+		 * @return The columns of the records, in document order
+		 * @throws daw::json::json_exception
+		 */
+		template<typename Record, typename String>
+		[[nodiscard]] record_columns<Record>
+		from_json_columns( String &&json_data ) {
+			return from_json_columns<Record>( DAW_FWD( json_data ),
+			                                  options::parse_flags<> );
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -0,0 +1,273 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_link_types.h"
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_parse_digit.h"
+#include "impl/daw_json_parse_unsigned_int.h"
+#include "impl/to_daw_json_string.h"
+
+#include <daw/daw_arith_traits.h>
+#include <daw/daw_attributes.h>
+#include <daw/daw_cpp_feature_check.h>
+
+#include <ciso646>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * An exact decimal number, significand * 10^exponent.  The digits are
+		 * kept as they were in the JSON document, so 1.50 has a significand of
+		 * 150 and an exponent of -2.  Comparison is of the representation,
+		 * 1.50 and 1.5 are not equal.
+		 * @tparam Significand A signed integer type, std::int64_t or __int128
+		 */
+		template<typename Significand>
+		struct basic_decimal {
+			static_assert( daw::is_integral_v<Significand> and
+			                 not daw::is_unsigned_v<Significand>,
+			               "The significand must be a signed integer" );
+			using significand_type = Significand;
+
+			Significand significand = 0;
+			std::int32_t exponent = 0;
+
+			[[nodiscard]] friend constexpr bool
+			operator==( basic_decimal const &lhs, basic_decimal const &rhs ) {
+				return lhs.significand == rhs.significand and
+				       lhs.exponent == rhs.exponent;
+			}
+
+			[[nodiscard]] friend constexpr bool
+			operator!=( basic_decimal const &lhs, basic_decimal const &rhs ) {
+				return not( lhs == rhs );
+			}
+		};
+
+		/// Up to 18 significant digits
+		using decimal64 = basic_decimal<std::int64_t>;
+#if defined( DAW_HAS_INT128 )
+		/// Up to 38 significant digits
+		using decimal128 = basic_decimal<__int128>;
+#endif
+
+		namespace json_details {
+			/***
+			 * Parse a JSON number into an exact decimal in one pass.  The integer
+			 * and fraction digits are accumulated into the significand, 8 at a
+			 * time when possible, and the exponent is adjusted by the count of
+			 * fraction digits.  Significands that do not fit are an error with
+			 * ErrorReason::NumberOutOfRange
+			 */
+			template<typename Decimal>
+			[[nodiscard]] static constexpr Decimal
+			parse_decimal( std::string_view sv ) {
+				using significand_t = typename Decimal::significand_type;
+				using unsigned_t = unsigned_magnitude_t<significand_t>;
+
+				char const *first = std::data( sv );
+				char const *const last = first + std::size( sv );
+				bool const is_negative = first < last and *first == '-';
+				if( is_negative ) {
+					++first;
+				}
+				// The magnitude of the lowest value is one more than the highest
+				unsigned_t const limit =
+				  static_cast<unsigned_t>(
+				    ( daw::numeric_limits<significand_t>::max )( ) ) +
+				  static_cast<unsigned_t>( is_negative );
+				unsigned_t result = 0;
+
+				auto const parse_digits = [&] {
+					char const *const start = first;
+					while( last - first >= 8 and is_made_of_eight_digits_cx( first ) ) {
+						auto const chunk = static_cast<unsigned_t>(
+						  static_cast<std::uint64_t>( parse_8_digits( first ) ) );
+						daw_json_ensure( result <= ( limit - chunk ) / 100'000'000U,
+						                 ErrorReason::NumberOutOfRange );
+						result = result * 100'000'000U + chunk;
+						first += 8;
+					}
+					while( first < last and parse_digit( *first ) < 10U ) {
+						auto const dig = static_cast<unsigned_t>( parse_digit( *first ) );
+						daw_json_ensure( result <= ( limit - dig ) / 10U,
+						                 ErrorReason::NumberOutOfRange );
+						result = result * 10U + dig;
+						++first;
+					}
+					return first - start;
+				};
+
+				daw_json_ensure( parse_digits( ) > 0, ErrorReason::InvalidNumber );
+				std::int64_t exponent = 0;
+				if( first < last and *first == '.' ) {
+					++first;
+					auto const fraction_digits = parse_digits( );
+					daw_json_ensure( fraction_digits > 0, ErrorReason::InvalidNumber );
+					exponent -= fraction_digits;
+				}
+				if( first < last and ( *first == 'e' or *first == 'E' ) ) {
+					++first;
+					bool const is_exp_negative = first < last and *first == '-';
+					if( first < last and ( *first == '-' or *first == '+' ) ) {
+						++first;
+					}
+					daw_json_ensure( first < last and parse_digit( *first ) < 10U,
+					                 ErrorReason::InvalidNumber );
+					std::int64_t exp = 0;
+					while( first < last and parse_digit( *first ) < 10U ) {
+						exp *= 10;
+						exp += static_cast<std::int64_t>( parse_digit( *first ) );
+						daw_json_ensure( exp <= 1'000'000'000,
+						                 ErrorReason::NumberOutOfRange );
+						++first;
+					}
+					exponent += is_exp_negative ? -exp : exp;
+				}
+				while( first < last and ( *first == ' ' or *first == '\t' or
+				                          *first == '\n' or *first == '\r' ) ) {
+					++first;
+				}
+				daw_json_ensure( first == last, ErrorReason::InvalidNumber );
+				daw_json_ensure(
+				  exponent >= ( std::numeric_limits<std::int32_t>::min )( ) and
+				    exponent <= ( std::numeric_limits<std::int32_t>::max )( ),
+				  ErrorReason::NumberOutOfRange );
+
+				if( is_negative ) {
+					result = unsigned_t{ 0 } - result;
+				}
+				Decimal dec{ };
+				dec.significand = static_cast<significand_t>( result );
+				dec.exponent = static_cast<std::int32_t>( exponent );
+				return dec;
+			}
+
+			/***
+			 * Write dec so that parsing it gives the same significand and
+			 * exponent.  A decimal point is used when the exponent is negative and
+			 * at most 6 zeros are needed after it, otherwise the digits are
+			 * followed by an exponent
+			 * @pre buffer has room for 64 characters
+			 * @return pointer to one past the last character written
+			 */
+			template<typename Decimal>
+			static constexpr char *write_decimal( char *ptr, Decimal const &dec ) {
+				using significand_t = typename Decimal::significand_type;
+				using unsigned_t = unsigned_magnitude_t<significand_t>;
+				constexpr std::int32_t max_leading_zeros = 6;
+
+				auto magnitude = static_cast<unsigned_t>( dec.significand );
+				if( dec.significand < 0 ) {
+					*ptr++ = '-';
+					magnitude = unsigned_t{ 0 } - magnitude;
+				}
+				char digits[40]{ };
+				auto const digit_count = static_cast<std::int32_t>(
+				  write_base10_digits( digits, magnitude ) - digits );
+				auto const copy_digits = [&]( std::int32_t pos, std::int32_t end ) {
+					for( ; pos < end; ++pos ) {
+						*ptr++ = digits[pos];
+					}
+				};
+				std::int32_t const exponent = dec.exponent;
+				if( exponent < 0 ) {
+					std::int32_t const point = digit_count + exponent;
+					if( point > 0 ) {
+						copy_digits( 0, point );
+						*ptr++ = '.';
+						copy_digits( point, digit_count );
+						return ptr;
+					}
+					if( -point <= max_leading_zeros ) {
+						*ptr++ = '0';
+						*ptr++ = '.';
+						for( std::int32_t n = point; n < 0; ++n ) {
+							*ptr++ = '0';
+						}
+						copy_digits( 0, digit_count );
+						return ptr;
+					}
+				}
+				copy_digits( 0, digit_count );
+				if( exponent != 0 ) {
+					*ptr++ = 'e';
+					auto exp_magnitude = static_cast<std::uint32_t>( exponent );
+					if( exponent < 0 ) {
+						*ptr++ = '-';
+						exp_magnitude = 0U - exp_magnitude;
+					}
+					ptr = write_base10_digits( ptr, exp_magnitude );
+				}
+				return ptr;
+			}
+
+			/***
+			 * The From and To converter used by json_decimal
+			 */
+			template<typename Decimal>
+			struct decimal_converter {
+				[[nodiscard]] constexpr Decimal
+				operator( )( std::string_view sv ) const {
+					return parse_decimal<Decimal>( sv );
+				}
+
+				template<typename WritableType>
+				[[nodiscard]] constexpr WritableType
+				operator( )( WritableType it, Decimal const &dec ) const {
+					char buff[64]{ };
+					char *const last = write_decimal( buff, dec );
+					it.copy_buffer( buff, last );
+					return it;
+				}
+			};
+		} // namespace json_details
+
+		/***
+		 * @brief Map a JSON number to an exact decimal, without the rounding of a
+		 * double
+		 * @tparam Name Name of JSON member to link to
+		 * @tparam Decimal basic_decimal type to parse to, decimal64 by default
+		 */
+		template<JSONNAMETYPE Name, typename Decimal = decimal64>
+		using json_decimal =
+		  json_custom_lit<Name, Decimal, json_details::decimal_converter<Decimal>,
+		                  json_details::decimal_converter<Decimal>>;
+
+		template<typename Decimal = decimal64>
+		using json_decimal_no_name =
+		  json_custom_lit_no_name<Decimal,
+		                          json_details::decimal_converter<Decimal>,
+		                          json_details::decimal_converter<Decimal>>;
+
+		/***
+		 * @brief Map a nullable JSON number to an exact decimal
+		 * @tparam Name Name of JSON member to link to
+		 * @tparam WrappedDecimal Nullable type holding the decimal, e.g.
+		 * std::optional<decimal64>
+		 */
+		template<JSONNAMETYPE Name,
+		         typename WrappedDecimal = std::optional<decimal64>>
+		using json_decimal_null = json_custom_lit_null<
+		  Name, WrappedDecimal,
+		  json_details::decimal_converter<
+		    json_details::unwrapped_t<WrappedDecimal>>,
+		  json_details::decimal_converter<
+		    json_details::unwrapped_t<WrappedDecimal>>>;
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -53,6 +53,15 @@ namespace daw::json {
 			}
 		};
 
+		/// @brief Refill an existing value with the parsed elements instead of
+		/// constructing a new one, keeping its capacity.  Used by from_json_into.
+		/// Specializations provide operator( )( T &value, Iterator first,
+		/// Iterator last ).  Without one the value is assigned a newly
+		/// constructed one
+		/// @tparam T type of container to refill
+		template<typename T, typename = void>
+		struct reuse_constructor {};
+
 		/// @brief Default constructor for nullable types.
 		/// Specializations must accept accept an operator( )( ) that signifies a
 		/// JSON null. Any other arguments only need to be valid to construct the
@@ -0,0 +1,311 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_link_types.h"
+#include "impl/daw_json_assert.h"
+
+#include <daw/daw_attributes.h>
+#include <daw/daw_likely.h>
+#include <daw/daw_traits.h>
+
+#include <array>
+#include <ciso646>
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * The JSON name of an enumerator
+		 */
+		template<typename Enum>
+		struct json_enum_name {
+			Enum value;
+			std::string_view name;
+		};
+
+		/***
+		 * Specialize for an enum to list the JSON names of it's enumerators in a
+		 * `static constexpr json_enum_name<Enum> values[]` member.  json_enum uses
+		 * this when no names type is supplied.  When more than one name has the
+		 * same value, the first is used when serializing.
+		 */
+		template<typename Enum>
+		struct json_enum_names;
+
+		namespace json_details {
+			/***
+			 * Lookup tables generated from the names of an enum.  Parsing only
+			 * compares the names with the same length as the input, and
+			 * serializing indexes a table by value when the values are dense or
+			 * does a binary search otherwise.
+			 */
+			template<typename Enum, typename EnumNames>
+			struct enum_name_table {
+				static_assert( std::is_enum_v<Enum>, "json_enum requires an enum" );
+				static constexpr auto const &values = EnumNames::values;
+				static constexpr std::size_t size = std::size( values );
+				static_assert( size > 0, "At least one enum name is required" );
+
+				using underlying_t = std::underlying_type_t<Enum>;
+				using wide_t = std::conditional_t<std::is_signed_v<underlying_t>,
+				                                  long long, unsigned long long>;
+
+				DAW_ATTRIB_INLINE static constexpr wide_t to_wide( Enum e ) {
+					return static_cast<wide_t>( static_cast<underlying_t>( e ) );
+				}
+
+				static constexpr bool has_valid_names( ) {
+					for( std::size_t n = 0; n < size; ++n ) {
+						if( values[n].name.empty( ) ) {
+							return false;
+						}
+						for( char c : values[n].name ) {
+							// The names are written without escaping
+							if( c == '"' or c == '\\' or
+							    static_cast<unsigned char>( c ) < 0x20U ) {
+								return false;
+							}
+						}
+						for( std::size_t m = n + 1; m < size; ++m ) {
+							if( values[n].name == values[m].name ) {
+								return false;
+							}
+						}
+					}
+					return true;
+				}
+				static_assert( has_valid_names( ),
+				               "Enum names must be unique, non-empty and not need "
+				               "escaping" );
+
+				static constexpr std::size_t max_length = [] {
+					std::size_t result = 0;
+					for( std::size_t n = 0; n < size; ++n ) {
+						if( values[n].name.size( ) > result ) {
+							result = values[n].name.size( );
+						}
+					}
+					return result;
+				}( );
+
+				/// The index of each name, ordered by the length of the name
+				static constexpr std::array<std::size_t, size> by_length = [] {
+					std::array<std::size_t, size> result{ };
+					std::size_t pos = 0;
+					for( std::size_t len = 1; len <= max_length; ++len ) {
+						for( std::size_t n = 0; n < size; ++n ) {
+							if( values[n].name.size( ) == len ) {
+								result[pos++] = n;
+							}
+						}
+					}
+					return result;
+				}( );
+
+				/// The names of length len are at
+				/// by_length[length_start[len]..length_start[len + 1])
+				static constexpr std::array<std::size_t, max_length + 2> length_start =
+				  [] {
+					  std::array<std::size_t, max_length + 2> result{ };
+					  for( std::size_t n = 0; n < size; ++n ) {
+						  ++result[values[n].name.size( ) + 1];
+					  }
+					  for( std::size_t len = 1; len < result.size( ); ++len ) {
+						  result[len] += result[len - 1];
+					  }
+					  return result;
+				  }( );
+
+				static constexpr wide_t min_value = [] {
+					wide_t result = to_wide( values[0].value );
+					for( std::size_t n = 1; n < size; ++n ) {
+						if( to_wide( values[n].value ) < result ) {
+							result = to_wide( values[n].value );
+						}
+					}
+					return result;
+				}( );
+
+				static constexpr wide_t max_value = [] {
+					wide_t result = to_wide( values[0].value );
+					for( std::size_t n = 1; n < size; ++n ) {
+						if( to_wide( values[n].value ) > result ) {
+							result = to_wide( values[n].value );
+						}
+					}
+					return result;
+				}( );
+
+				static constexpr unsigned long long value_span =
+				  static_cast<unsigned long long>( max_value ) -
+				  static_cast<unsigned long long>( min_value );
+
+				/// Values that are mostly contiguous, like those of enums without
+				/// explicit values, are looked up with a table indexed by value
+				static constexpr bool is_dense = value_span < 2U * size + 16U;
+
+				static constexpr std::size_t by_value_size =
+				  is_dense ? static_cast<std::size_t>( value_span ) + 1U : 1U;
+
+				static constexpr std::array<std::string_view, by_value_size> by_value =
+				  [] {
+					  std::array<std::string_view, by_value_size> result{ };
+					  if constexpr( is_dense ) {
+						  for( std::size_t n = 0; n < size; ++n ) {
+							  auto const idx = static_cast<std::size_t>(
+							    static_cast<unsigned long long>(
+							      to_wide( values[n].value ) ) -
+							    static_cast<unsigned long long>( min_value ) );
+							  if( result[idx].empty( ) ) {
+								  result[idx] = values[n].name;
+							  }
+						  }
+					  }
+					  return result;
+				  }( );
+
+				/// The index of each name ordered by value, keeping the original
+				/// order of equal values
+				static constexpr std::array<std::size_t, size> sorted_by_value = [] {
+					std::array<std::size_t, size> result{ };
+					for( std::size_t n = 0; n < size; ++n ) {
+						std::size_t pos = n;
+						while( pos > 0 and to_wide( values[result[pos - 1]].value ) >
+						                     to_wide( values[n].value ) ) {
+							result[pos] = result[pos - 1];
+							--pos;
+						}
+						result[pos] = n;
+					}
+					return result;
+				}( );
+
+				[[nodiscard]] static constexpr Enum parse( std::string_view sv ) {
+					if( DAW_LIKELY( sv.size( ) <= max_length ) ) {
+						auto const last = length_start[sv.size( ) + 1];
+						for( auto pos = length_start[sv.size( )]; pos < last; ++pos ) {
+							auto const &item = values[by_length[pos]];
+							if( item.name == sv ) {
+								return item.value;
+							}
+						}
+					}
+					daw_json_error( ErrorReason::UnknownEnumValue );
+				}
+
+				[[nodiscard]] static constexpr std::string_view
+				name_of( Enum e ) {
+					auto const v = to_wide( e );
+					if constexpr( is_dense ) {
+						if( DAW_LIKELY( v >= min_value and v <= max_value ) ) {
+							auto const name = by_value[static_cast<std::size_t>(
+							  static_cast<unsigned long long>( v ) -
+							  static_cast<unsigned long long>( min_value ) )];
+							if( DAW_LIKELY( not name.empty( ) ) ) {
+								return name;
+							}
+						}
+					} else {
+						std::size_t first = 0;
+						std::size_t count = size;
+						while( count > 0 ) {
+							auto const step = count / 2;
+							if( to_wide( values[sorted_by_value[first + step]].value ) <
+							    v ) {
+								first += step + 1;
+								count -= step + 1;
+							} else {
+								count = step;
+							}
+						}
+						if( first < size and
+						    to_wide( values[sorted_by_value[first]].value ) == v ) {
+							return values[sorted_by_value[first]].name;
+						}
+					}
+					daw_json_error( ErrorReason::UnknownEnumValue );
+				}
+			};
+
+			template<typename Enum, typename EnumNames>
+			using enum_names_t = typename std::conditional_t<
+			  std::is_same_v<use_default, EnumNames>,
+			  daw::traits::identity<json_enum_names<Enum>>,
+			  daw::traits::identity<EnumNames>>::type;
+
+			/***
+			 * The From and To converter used by json_enum.  The name is written
+			 * directly to the output when serializing
+			 */
+			template<typename Enum, typename EnumNames>
+			struct enum_converter {
+				using table_t = enum_name_table<Enum, enum_names_t<Enum, EnumNames>>;
+
+				[[nodiscard]] constexpr Enum
+				operator( )( std::string_view sv ) const {
+					return table_t::parse( sv );
+				}
+
+				[[nodiscard]] constexpr std::string_view operator( )( Enum e ) const {
+					return table_t::name_of( e );
+				}
+
+				template<typename WritableType>
+				[[nodiscard]] constexpr WritableType
+				operator( )( WritableType it, Enum e ) const {
+					it.write( table_t::name_of( e ) );
+					return it;
+				}
+			};
+		} // namespace json_details
+
+		/***
+		 * @brief Map an enum to and from the JSON string names of it's
+		 * enumerators
+		 * @tparam Name Name of JSON member to link to
+		 * @tparam Enum enum type of the member
+		 * @tparam EnumNames A type with a `static constexpr json_enum_name<Enum>
+		 * values[]` member.  The default is json_enum_names<Enum>
+		 */
+		template<JSONNAMETYPE Name, typename Enum,
+		         typename EnumNames = use_default>
+		using json_enum =
+		  json_custom<Name, Enum, json_details::enum_converter<Enum, EnumNames>,
+		              json_details::enum_converter<Enum, EnumNames>>;
+
+		template<typename Enum, typename EnumNames = use_default>
+		using json_enum_no_name =
+		  json_custom_no_name<Enum, json_details::enum_converter<Enum, EnumNames>,
+		                      json_details::enum_converter<Enum, EnumNames>>;
+
+		/***
+		 * @brief Map a nullable enum to and from the JSON string names of it's
+		 * enumerators
+		 * @tparam Name Name of JSON member to link to
+		 * @tparam WrappedEnum Nullable type holding the enum, e.g.
+		 * std::optional<Enum>
+		 * @tparam EnumNames A type with a `static constexpr json_enum_name<Enum>
+		 * values[]` member.  The default is json_enum_names<Enum>
+		 */
+		template<JSONNAMETYPE Name, typename WrappedEnum,
+		         typename EnumNames = use_default>
+		using json_enum_null = json_custom_null<
+		  Name, WrappedEnum,
+		  json_details::enum_converter<json_details::unwrapped_t<WrappedEnum>,
+		                               EnumNames>,
+		  json_details::enum_converter<json_details::unwrapped_t<WrappedEnum>,
+		                               EnumNames>>;
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -111,7 +111,9 @@ namespace daw::json {
 			ExpectedMemberNotFound,
 			ExpectedTokenNotFound,
 			UnexpectedJSONVariantType,
-			TrailingComma
+			TrailingComma,
+			ArrayCapacityExceeded,
+			UnknownEnumValue
 		};
 
 		constexpr std::string_view reason_message( ErrorReason er ) {
@@ -211,6 +213,10 @@ namespace daw::json {
 				return "Unexpected JSON Variant Type"sv;
 			case ErrorReason::TrailingComma:
 				return "Trailing comma"sv;
+			case ErrorReason::ArrayCapacityExceeded:
+				return "Array has more elements than its container can hold"sv;
+			case ErrorReason::UnknownEnumValue:
+				return "Value is not one of the enum's names"sv;
 			}
 			DAW_UNREACHABLE( );
 		}
@@ -0,0 +1,212 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_from_json.h"
+#include "daw_json_link_types.h"
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_parse_digit.h"
+#include "impl/to_daw_json_string.h"
+
+#include <daw/daw_attributes.h>
+
+#include <ciso646>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * A number whose text is kept from the parse and only converted to
+		 * Number the first time it is read.  The text refers to the JSON
+		 * document, which must outlive the lazy_number until it is converted.
+		 * The cached value is not synchronized, converting the same lazy_number
+		 * from more than one thread at a time is a data race.
+		 * @tparam Number Arithmetic type the text is converted to
+		 * @tparam ParseFlags The options::parse_flags_t used to convert the
+		 * text, e.g. options::parse_flags_t<options::IEEE754Precise::yes>
+		 */
+		template<typename Number, typename ParseFlags = options::parse_flags_t<>>
+		class lazy_number {
+			std::string_view m_text{ };
+			mutable Number m_value{ };
+			mutable bool m_has_value = false;
+
+		public:
+			using value_type = Number;
+
+			lazy_number( ) = default;
+
+			/// @param text The JSON number, converted on first access
+			explicit constexpr lazy_number( std::string_view text )
+			  : m_text( text ) {}
+
+			/// @param value An already converted value, serialized from value
+			constexpr lazy_number( Number value )
+			  : m_value( value )
+			  , m_has_value( true ) {}
+
+			/// @return The JSON text of the number, empty when constructed from a
+			/// value
+			[[nodiscard]] constexpr std::string_view text( ) const {
+				return m_text;
+			}
+
+			/// @return true if the value has been converted from the text already
+			[[nodiscard]] constexpr bool is_converted( ) const {
+				return m_has_value;
+			}
+
+			/// @return The value, converting the text on the first call
+			[[nodiscard]] Number const &get( ) const {
+				if( not m_has_value ) {
+					m_value = from_json<json_number_no_name<Number>, true>(
+					  m_text, ParseFlags{ } );
+					m_has_value = true;
+				}
+				return m_value;
+			}
+
+			[[nodiscard]] Number const &operator*( ) const {
+				return get( );
+			}
+		};
+
+		namespace json_details {
+			/***
+			 * Check the JSON number grammar without converting, leading zeros are
+			 * allowed as in the rest of the number parsing
+			 */
+			[[nodiscard]] static constexpr bool
+			is_json_number( std::string_view sv ) {
+				char const *first = std::data( sv );
+				char const *const last = first + std::size( sv );
+				auto const skip_digits = [&] {
+					char const *const start = first;
+					while( first < last and parse_digit( *first ) < 10U ) {
+						++first;
+					}
+					return first != start;
+				};
+				if( first < last and *first == '-' ) {
+					++first;
+				}
+				if( not skip_digits( ) ) {
+					return false;
+				}
+				if( first < last and *first == '.' ) {
+					++first;
+					if( not skip_digits( ) ) {
+						return false;
+					}
+				}
+				if( first < last and ( *first == 'e' or *first == 'E' ) ) {
+					++first;
+					if( first < last and ( *first == '-' or *first == '+' ) ) {
+						++first;
+					}
+					if( not skip_digits( ) ) {
+						return false;
+					}
+				}
+				return first == last;
+			}
+
+			/***
+			 * The From and To converter used by json_lazy_number.  Parsing only
+			 * keeps the span found by skipping the number, and when
+			 * ValidateSyntax is true checks its grammar.  Serializing writes the
+			 * original text when there is one, checking it first when that was
+			 * not done while parsing.
+			 */
+			template<typename Number, bool ValidateSyntax, typename ParseFlags>
+			struct lazy_number_converter {
+				using lazy_number_t = lazy_number<Number, ParseFlags>;
+
+				[[nodiscard]] constexpr lazy_number_t
+				operator( )( std::string_view sv ) const {
+					// Known bounds can include the whitespace after the number
+					while( not sv.empty( ) and
+					       ( sv.back( ) == ' ' or sv.back( ) == '\t' or
+					         sv.back( ) == '\n' or sv.back( ) == '\r' ) ) {
+						sv.remove_suffix( 1 );
+					}
+					if constexpr( ValidateSyntax ) {
+						daw_json_ensure( is_json_number( sv ),
+						                 ErrorReason::InvalidNumber );
+					}
+					return lazy_number_t( sv );
+				}
+
+				template<typename WritableType>
+				[[nodiscard]] constexpr WritableType
+				operator( )( WritableType it, lazy_number_t const &v ) const {
+					if( not v.text( ).empty( ) ) {
+						if constexpr( not ValidateSyntax ) {
+							// Do not write text that is not a number into the output
+							daw_json_ensure( is_json_number( v.text( ) ),
+							                 ErrorReason::InvalidNumber );
+						}
+						it.write( v.text( ) );
+						return it;
+					}
+					using number_t = json_number_no_name<Number>;
+					return to_daw_json_string<number_t>(
+					  ParseTag<number_t::expected_type>{ }, it, v.get( ) );
+				}
+			};
+		} // namespace json_details
+
+		/***
+		 * @brief Map a JSON number that is converted the first time it is read
+		 * @tparam Name Name of JSON member to link to
+		 * @tparam Number Arithmetic type the number is converted to
+		 * @tparam ValidateSyntax Check the number grammar while parsing, the
+		 * arithmetic is still deferred.  When false, it is checked when the
+		 * text is serialized instead
+		 * @tparam ParseFlags The options::parse_flags_t used to convert the
+		 * number
+		 */
+		template<JSONNAMETYPE Name, typename Number = double,
+		         bool ValidateSyntax = true,
+		         typename ParseFlags = options::parse_flags_t<>>
+		using json_lazy_number = json_custom_lit<
+		  Name, lazy_number<Number, ParseFlags>,
+		  json_details::lazy_number_converter<Number, ValidateSyntax, ParseFlags>,
+		  json_details::lazy_number_converter<Number, ValidateSyntax, ParseFlags>>;
+
+		template<typename Number = double, bool ValidateSyntax = true,
+		         typename ParseFlags = options::parse_flags_t<>>
+		using json_lazy_number_no_name = json_custom_lit_no_name<
+		  lazy_number<Number, ParseFlags>,
+		  json_details::lazy_number_converter<Number, ValidateSyntax, ParseFlags>,
+		  json_details::lazy_number_converter<Number, ValidateSyntax, ParseFlags>>;
+
+		/***
+		 * @brief Map a nullable JSON number that is converted the first time it
+		 * is read
+		 * @tparam Name Name of JSON member to link to
+		 * @tparam Number Arithmetic type the number is converted to
+		 * @tparam ValidateSyntax Check the number grammar while parsing
+		 * @tparam ParseFlags The options::parse_flags_t used to convert the
+		 * number
+		 */
+		template<JSONNAMETYPE Name, typename Number = double,
+		         bool ValidateSyntax = true,
+		         typename ParseFlags = options::parse_flags_t<>>
+		using json_lazy_number_null = json_custom_lit_null<
+		  Name, std::optional<lazy_number<Number, ParseFlags>>,
+		  json_details::lazy_number_converter<Number, ValidateSyntax, ParseFlags>,
+		  json_details::lazy_number_converter<Number, ValidateSyntax, ParseFlags>>;
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
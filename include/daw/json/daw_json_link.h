@@ -11,7 +11,10 @@
 #include "impl/version.h"
 
 #include "daw_from_json.h"
+#include "daw_json_decimal.h"
+#include "daw_json_enum.h"
 #include "daw_json_exception.h"
+#include "daw_json_lazy_number.h"
 #include "daw_json_link_types.h"
 #include "daw_to_json.h"
 #include "impl/daw_json_alternate_mapping.h"
@@ -0,0 +1,263 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "concepts/daw_writable_output.h"
+#include "daw_to_json_fwd.h"
+#include "impl/daw_json_assert.h"
+#include "impl/daw_json_exec_modes.h"
+#include "impl/daw_json_parse_policy_policy_details.h"
+#include "impl/daw_json_serialize_policy.h"
+#include "impl/daw_not_const_ex_functions.h"
+
+#include <daw/daw_move.h>
+#include <daw/daw_string_view.h>
+#include <daw/daw_traits.h>
+
+#include <ciso646>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details::minify {
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr bool is_ws( char c ) {
+				return static_cast<bool>( static_cast<unsigned>( c == ' ' ) |
+				                          static_cast<unsigned>( c == '\n' ) |
+				                          static_cast<unsigned>( c == '\r' ) |
+				                          static_cast<unsigned>( c == '\t' ) );
+			}
+
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr char const *
+			skip_ws( char const *first, char const *const last ) {
+				while( first < last and is_ws( *first ) ) {
+					++first;
+				}
+				return first;
+			}
+
+			/// @brief The tokens that can come next in the document
+			enum class expected_token {
+				value,       // A value, at the start or after a ':' or ',' in an array
+				member_name, // After a '{' or ',' in a class
+				colon,       // After a member name
+				separator    // After a value, a ',' or the closing bracket
+			};
+
+			/***
+			 * Copy a JSON document token by token to the serialization policy.
+			 * Strings, numbers and literals are copied verbatim, the structural
+			 * characters are written through the policy so that the indentation
+			 * and newlines follow its options.  The order of the tokens and the
+			 * bracketing are validated, the contents of numbers and literals are
+			 * not, so this is not a conforming parser.  The opening brackets of the
+			 * current path are kept to check that each closing one matches.
+			 * @return The position after the end of the root value
+			 */
+			template<typename SerializationPolicy>
+			char const *reformat( char const *first, char const *const last,
+			                      SerializationPolicy &out ) {
+				// The opening brackets of the classes and arrays being copied
+				std::string openers{ };
+				auto expected = expected_token::value;
+				auto const after_separator = [&] {
+					return openers.back( ) == '{' ? expected_token::member_name
+					                              : expected_token::value;
+				};
+				do {
+					first = skip_ws( first, last );
+					daw_json_ensure( first < last, ErrorReason::UnexpectedEndOfData );
+					char const c = *first;
+					switch( c ) {
+					case '"': {
+						daw_json_ensure( expected == expected_token::value or
+						                   expected == expected_token::member_name,
+						                 ErrorReason::ExpectedTokenNotFound );
+						char const *const str_first = first;
+						first = mem_skip_until_end_of_string<false>( simd_exec_tag{ },
+						                                              first + 1, last );
+						daw_json_ensure( first < last and *first == '"',
+						                 ErrorReason::InvalidString );
+						++first;
+						out.copy_buffer( str_first, first );
+						expected = expected == expected_token::member_name
+						             ? expected_token::colon
+						             : expected_token::separator;
+						break;
+					}
+					case '{':
+					case '[': {
+						daw_json_ensure( expected != expected_token::member_name,
+						                 ErrorReason::MissingMemberName );
+						daw_json_ensure( expected == expected_token::value,
+						                 ErrorReason::ExpectedTokenNotFound );
+						char const close_char = c == '{' ? '}' : ']';
+						out.put( c );
+						first = skip_ws( first + 1, last );
+						daw_json_ensure( first < last, ErrorReason::UnexpectedEndOfData );
+						if( *first == close_char ) {
+							// Empty classes and arrays are written without a newline, the
+							// same as to_json does
+							out.put( close_char );
+							++first;
+							expected = expected_token::separator;
+						} else {
+							openers.push_back( c );
+							out.add_indent( );
+							out.next_member( );
+							expected = after_separator( );
+						}
+						break;
+					}
+					case '}':
+					case ']':
+						daw_json_ensure( not openers.empty( ) and
+						                   openers.back( ) == ( c == '}' ? '{' : '[' ),
+						                 ErrorReason::InvalidBracketing );
+						daw_json_ensure( expected != after_separator( ),
+						                 ErrorReason::TrailingComma );
+						daw_json_ensure( expected == expected_token::separator,
+						                 ErrorReason::ExpectedTokenNotFound );
+						openers.pop_back( );
+						out.del_indent( );
+						if constexpr( SerializationPolicy::output_trailing_comma ==
+						              options::OutputTrailingComma::Yes ) {
+							out.put( ',' );
+						}
+						out.next_member( );
+						out.put( c );
+						++first;
+						break;
+					case ',':
+						daw_json_ensure( not openers.empty( ),
+						                 ErrorReason::InvalidBracketing );
+						daw_json_ensure( expected == expected_token::separator,
+						                 ErrorReason::ExpectedTokenNotFound );
+						out.put( ',' );
+						out.next_member( );
+						++first;
+						expected = after_separator( );
+						break;
+					case ':':
+						daw_json_ensure( not openers.empty( ) and openers.back( ) == '{',
+						                 ErrorReason::InvalidBracketing );
+						daw_json_ensure( expected == expected_token::colon,
+						                 ErrorReason::ExpectedTokenNotFound );
+						out.write( ':', out.space );
+						++first;
+						expected = expected_token::value;
+						break;
+					default: {
+						daw_json_ensure( parse_policy_details::is_number_start( c ) or
+						                   c == 't' or c == 'f' or c == 'n',
+						                 ErrorReason::InvalidStartOfValue );
+						daw_json_ensure( expected != expected_token::member_name,
+						                 ErrorReason::MissingMemberName );
+						daw_json_ensure( expected == expected_token::value,
+						                 ErrorReason::ExpectedTokenNotFound );
+						char const *const value_first = first;
+						while( first < last and
+						       not parse_policy_details::at_end_of_item( *first ) ) {
+							++first;
+						}
+						out.copy_buffer( value_first, first );
+						expected = expected_token::separator;
+						break;
+					}
+					}
+				} while( not openers.empty( ) );
+				return first;
+			}
+		} // namespace json_details::minify
+
+		/***
+		 * Reformat a JSON document without parsing it into values.  Tokens are
+		 * copied from the input to the output and the whitespace is replaced
+		 * with that specified by the serialization options, e.g.
+		 * `options::output_flags<options::SerializationFormat::Pretty>`.  String
+		 * contents, including escapes, are copied as is.  Comments are not
+		 * supported
+		 * @param json_doc The JSON document to reformat
+		 * @param it A writable output, as used by to_json
+		 * @throws daw::json::json_exception When the brackets do not match, a
+		 * separator is missing or misplaced, or there is data after the root
+		 * value
+		 * @return The writable output
+		 */
+		template<typename WritableType, auto... PolicyFlags,
+		         std::enable_if_t<concepts::is_writable_output_type_v<
+		                            daw::remove_cvref_t<WritableType>>,
+		                          std::nullptr_t> = nullptr>
+		daw::rvalue_to_value_t<WritableType>
+		json_reformat( daw::string_view json_doc, WritableType &&it,
+		               options::output_flags_t<PolicyFlags...> =
+		                 options::output_flags<> ) {
+			if constexpr( std::is_pointer_v<daw::remove_cvref_t<WritableType>> ) {
+				daw_json_ensure( it != nullptr, ErrorReason::NullOutputIterator );
+			}
+			auto out = serialization_policy<
+			  daw::remove_cvref_t<WritableType>,
+			  options::output_flags_t<PolicyFlags...>::value>( it );
+			char const *const last = json_doc.data( ) + json_doc.size( );
+			char const *const value_last =
+			  json_details::minify::reformat( json_doc.data( ), last, out );
+			// Only whitespace can follow the root value
+			daw_json_ensure( json_details::minify::skip_ws( value_last, last ) ==
+			                   last,
+			                 ErrorReason::InvalidEndOfValue );
+			return out.get( );
+		}
+
+		/***
+		 * Reformat a JSON document into a std::string
+		 * @param json_doc The JSON document to reformat
+		 * @return A std::string with the reformatted document
+		 */
+		template<auto... PolicyFlags>
+		std::string json_reformat( daw::string_view json_doc,
+		                           options::output_flags_t<PolicyFlags...> flgs ) {
+			std::string result{ };
+			result.reserve( json_doc.size( ) );
+			(void)json_reformat( json_doc, result, flgs );
+			return result;
+		}
+
+		/***
+		 * Remove the insignificant whitespace from a JSON document
+		 * @param json_doc The JSON document to minify
+		 * @param it A writable output, as used by to_json
+		 * @return The writable output
+		 */
+		template<typename WritableType,
+		         std::enable_if_t<concepts::is_writable_output_type_v<
+		                            daw::remove_cvref_t<WritableType>>,
+		                          std::nullptr_t> = nullptr>
+		daw::rvalue_to_value_t<WritableType> json_minify( daw::string_view json_doc,
+		                                                  WritableType &&it ) {
+			return json_reformat(
+			  json_doc, DAW_FWD( it ),
+			  options::output_flags<options::SerializationFormat::Minified> );
+		}
+
+		/***
+		 * Remove the insignificant whitespace from a JSON document
+		 * @param json_doc The JSON document to minify
+		 * @return A std::string with the minified document
+		 */
+		inline std::string json_minify( daw::string_view json_doc ) {
+			std::string result{ };
+			result.reserve( json_doc.size( ) );
+			(void)json_minify( json_doc, result );
+			return result;
+		}
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
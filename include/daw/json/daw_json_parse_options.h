@@ -149,6 +149,34 @@ namespace daw::json {
 				/// default: no
 				///
 				enum class ExcludeSpecialEscapes : unsigned { no, yes }; // 1bit
+
+				///
+				/// @brief Count the elements of arrays and key/value maps before
+				/// parsing them so that containers whose constructor accepts a size,
+				/// like std::vector and std::unordered_map, can reserve the exact
+				/// amount. This is an extra pass over the array's
+				/// data unless the array was already skipped while finding a member.
+				///
+				/// default: no
+				///
+				enum class PrecountArrays : unsigned { no, yes }; // 1bit
+
+				///
+				/// @brief Decode escaped strings in place, inside the JSON buffer, so
+				/// that string types that refer to the buffer, like std::string_view
+				/// and borrowed_string, can be used with json_string. The buffer is
+				/// changed permanently and must outlive the result, a temporary
+				/// buffer that owns its characters, like a std::string or
+				/// std::vector<char> rvalue, is a compile error. If the buffer is not
+				/// mutable, e.g. a std::string_view or a const std::string, the option
+				/// is ignored without an error and strings are decoded into the
+				/// result as usual. Classes that are scanned a second time, those
+				/// with a json_tagged_variant or json_sized_array member, are parsed
+				/// without it.
+				///
+				/// default: no
+				///
+				enum class UnescapeInPlace : unsigned { no, yes }; // 1bit
 			} // namespace parser_options
 		}   // namespace options
 	}     // namespace DAW_JSON_VER
@@ -0,0 +1,415 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "daw_json_default_constuctor_fwd.h"
+#include "impl/daw_json_assert.h"
+
+#include <daw/daw_attributes.h>
+#include <daw/daw_likely.h>
+#include <daw/daw_move.h>
+
+#include <algorithm>
+#include <ciso646>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		/***
+		 * A vector that stores up to N elements in itself.  When AllowHeap is
+		 * true it moves the elements to the heap when it grows past N, otherwise
+		 * growing past N is an error with ErrorReason::ArrayCapacityExceeded.
+		 * Use small_vector and static_vector.
+		 */
+		template<typename T, std::size_t N, bool AllowHeap>
+		class inline_vector {
+			static_assert( N > 0, "The inline capacity must be greater than 0" );
+
+		public:
+			using value_type = T;
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using reference = T &;
+			using const_reference = T const &;
+			using pointer = T *;
+			using const_pointer = T const *;
+			using iterator = T *;
+			using const_iterator = T const *;
+			static constexpr std::size_t inline_capacity = N;
+			static constexpr bool allows_heap = AllowHeap;
+
+		private:
+			alignas( T ) unsigned char m_buffer[sizeof( T ) * N];
+			T *m_data = inline_data( );
+			std::size_t m_size = 0;
+			std::size_t m_capacity = N;
+
+			[[nodiscard]] T *inline_data( ) noexcept {
+				return reinterpret_cast<T *>( m_buffer );
+			}
+
+			void destroy_all( ) noexcept {
+				std::destroy( m_data, m_data + m_size );
+				m_size = 0;
+			}
+
+			void release_heap( ) noexcept {
+				if( not is_inline( ) ) {
+					std::allocator<T>{ }.deallocate( m_data, m_capacity );
+					m_data = inline_data( );
+					m_capacity = N;
+				}
+			}
+
+			/// @brief A heap buffer that is deallocated unless it is adopted by
+			/// the vector
+			struct heap_buffer {
+				T *data;
+				std::size_t capacity;
+
+				explicit heap_buffer( std::size_t cap )
+				  : data( std::allocator<T>{ }.allocate( cap ) )
+				  , capacity( cap ) {}
+
+				heap_buffer( heap_buffer const & ) = delete;
+				heap_buffer &operator=( heap_buffer const & ) = delete;
+
+				~heap_buffer( ) {
+					if( data != nullptr ) {
+						std::allocator<T>{ }.deallocate( data, capacity );
+					}
+				}
+			};
+
+			/// @brief Destroys an element unless released, used to undo
+			/// constructing it when the elements after it cannot be moved
+			struct element_guard {
+				T *element;
+
+				~element_guard( ) {
+					if( element != nullptr ) {
+						std::destroy_at( element );
+					}
+				}
+			};
+
+			[[nodiscard]] heap_buffer new_buffer( std::size_t min_capacity ) const {
+				return heap_buffer( ( std::max )( min_capacity, m_capacity * 2U ) );
+			}
+
+			/// @brief Move the elements into buf and use it as the storage.  When
+			/// moving can throw they are copied, so that they are unchanged if it
+			/// does
+			void adopt( heap_buffer &buf ) {
+				if constexpr( std::is_nothrow_move_constructible_v<T> or
+				              not std::is_copy_constructible_v<T> ) {
+					std::uninitialized_move( m_data, m_data + m_size, buf.data );
+				} else {
+					std::uninitialized_copy( m_data, m_data + m_size, buf.data );
+				}
+				std::size_t const sz = m_size;
+				destroy_all( );
+				release_heap( );
+				m_data = std::exchange( buf.data, nullptr );
+				m_size = sz;
+				m_capacity = buf.capacity;
+			}
+
+			DAW_ATTRIB_NOINLINE void grow( std::size_t min_capacity ) {
+				if constexpr( not AllowHeap ) {
+					daw_json_error( ErrorReason::ArrayCapacityExceeded );
+				} else {
+					auto buf = new_buffer( min_capacity );
+					adopt( buf );
+				}
+			}
+
+			/// @brief Append to a full vector.  The new element is constructed in
+			/// the new buffer before the old elements are moved, as args can refer
+			/// to one of them
+			template<typename... Args>
+			DAW_ATTRIB_NOINLINE T &grow_emplace_back( Args &&...args ) {
+				if constexpr( not AllowHeap ) {
+					daw_json_error( ErrorReason::ArrayCapacityExceeded );
+				} else {
+					auto buf = new_buffer( m_size + 1 );
+					T *const result = ::new( static_cast<void *>( buf.data + m_size ) )
+					  T( DAW_FWD( args )... );
+					auto guard = element_guard{ result };
+					adopt( buf );
+					guard.element = nullptr;
+					++m_size;
+					return *result;
+				}
+			}
+
+			/// @brief Take the elements of other, leaving it empty
+			void take( inline_vector &other ) noexcept(
+			  std::is_nothrow_move_constructible_v<T> ) {
+				if( other.is_inline( ) ) {
+					std::uninitialized_move( other.m_data, other.m_data + other.m_size,
+					                         m_data );
+					m_size = other.m_size;
+					other.destroy_all( );
+				} else {
+					m_data = other.m_data;
+					m_size = other.m_size;
+					m_capacity = other.m_capacity;
+					other.m_data = other.inline_data( );
+					other.m_size = 0;
+					other.m_capacity = N;
+				}
+			}
+
+		public:
+			inline_vector( ) noexcept {}
+
+			template<typename Iterator,
+			         std::enable_if_t<not std::is_integral_v<Iterator>,
+			                          std::nullptr_t> = nullptr>
+			inline_vector( Iterator first, Iterator last ) {
+				assign( first, last );
+			}
+
+			inline_vector( std::initializer_list<T> il ) {
+				assign( il.begin( ), il.end( ) );
+			}
+
+			inline_vector( inline_vector const &other ) {
+				assign( other.begin( ), other.end( ) );
+			}
+
+			inline_vector( inline_vector &&other ) noexcept(
+			  std::is_nothrow_move_constructible_v<T> ) {
+				take( other );
+			}
+
+			inline_vector &operator=( inline_vector const &rhs ) {
+				if( this != &rhs ) {
+					assign( rhs.begin( ), rhs.end( ) );
+				}
+				return *this;
+			}
+
+			inline_vector &operator=( inline_vector &&rhs ) noexcept(
+			  std::is_nothrow_move_constructible_v<T> ) {
+				if( this != &rhs ) {
+					destroy_all( );
+					release_heap( );
+					take( rhs );
+				}
+				return *this;
+			}
+
+			~inline_vector( ) {
+				destroy_all( );
+				release_heap( );
+			}
+
+			[[nodiscard]] T *data( ) noexcept {
+				return m_data;
+			}
+
+			[[nodiscard]] T const *data( ) const noexcept {
+				return m_data;
+			}
+
+			[[nodiscard]] std::size_t size( ) const noexcept {
+				return m_size;
+			}
+
+			[[nodiscard]] bool empty( ) const noexcept {
+				return m_size == 0;
+			}
+
+			[[nodiscard]] std::size_t capacity( ) const noexcept {
+				return m_capacity;
+			}
+
+			/// @brief Are the elements stored in the inline buffer
+			[[nodiscard]] bool is_inline( ) const noexcept {
+				return m_data == reinterpret_cast<T const *>( m_buffer );
+			}
+
+			[[nodiscard]] iterator begin( ) noexcept {
+				return m_data;
+			}
+
+			[[nodiscard]] const_iterator begin( ) const noexcept {
+				return m_data;
+			}
+
+			[[nodiscard]] const_iterator cbegin( ) const noexcept {
+				return m_data;
+			}
+
+			[[nodiscard]] iterator end( ) noexcept {
+				return m_data + m_size;
+			}
+
+			[[nodiscard]] const_iterator end( ) const noexcept {
+				return m_data + m_size;
+			}
+
+			[[nodiscard]] const_iterator cend( ) const noexcept {
+				return m_data + m_size;
+			}
+
+			[[nodiscard]] T &operator[]( std::size_t index ) noexcept {
+				return m_data[index];
+			}
+
+			[[nodiscard]] T const &operator[]( std::size_t index ) const noexcept {
+				return m_data[index];
+			}
+
+			[[nodiscard]] T &front( ) noexcept {
+				return *m_data;
+			}
+
+			[[nodiscard]] T const &front( ) const noexcept {
+				return *m_data;
+			}
+
+			[[nodiscard]] T &back( ) noexcept {
+				return m_data[m_size - 1];
+			}
+
+			[[nodiscard]] T const &back( ) const noexcept {
+				return m_data[m_size - 1];
+			}
+
+			void reserve( std::size_t new_capacity ) {
+				if( new_capacity > m_capacity ) {
+					grow( new_capacity );
+				}
+			}
+
+			template<typename... Args>
+			DAW_ATTRIB_INLINE T &emplace_back( Args &&...args ) {
+				if( DAW_UNLIKELY( m_size == m_capacity ) ) {
+					return grow_emplace_back( DAW_FWD( args )... );
+				}
+				T *const result = ::new( static_cast<void *>( m_data + m_size ) )
+				  T( DAW_FWD( args )... );
+				++m_size;
+				return *result;
+			}
+
+			void push_back( T const &value ) {
+				(void)emplace_back( value );
+			}
+
+			void push_back( T &&value ) {
+				(void)emplace_back( DAW_MOVE( value ) );
+			}
+
+			iterator insert( const_iterator pos, T value ) {
+				auto const index = static_cast<std::size_t>( pos - m_data );
+				(void)emplace_back( DAW_MOVE( value ) );
+				std::rotate( m_data + index, m_data + m_size - 1, m_data + m_size );
+				return m_data + index;
+			}
+
+			void pop_back( ) noexcept {
+				--m_size;
+				std::destroy_at( m_data + m_size );
+			}
+
+			/// @brief Remove the elements, keeping the capacity
+			void clear( ) noexcept {
+				destroy_all( );
+			}
+
+			template<typename Iterator>
+			void assign( Iterator first, Iterator last ) {
+				clear( );
+				if constexpr( std::is_base_of_v<std::forward_iterator_tag,
+				                                typename std::iterator_traits<
+				                                  Iterator>::iterator_category> ) {
+					reserve( static_cast<std::size_t>( std::distance( first, last ) ) );
+				}
+				for( ; first != last; ++first ) {
+					(void)emplace_back( *first );
+				}
+			}
+
+			[[nodiscard]] friend bool operator==( inline_vector const &lhs,
+			                                      inline_vector const &rhs ) {
+				return std::equal( lhs.begin( ), lhs.end( ), rhs.begin( ),
+				                   rhs.end( ) );
+			}
+
+			[[nodiscard]] friend bool operator!=( inline_vector const &lhs,
+			                                      inline_vector const &rhs ) {
+				return not( lhs == rhs );
+			}
+		};
+
+		/// @brief A vector that stores up to N elements without allocating and
+		/// moves to the heap when it grows past that
+		template<typename T, std::size_t N>
+		using small_vector = inline_vector<T, N, true>;
+
+		/// @brief A vector with a fixed capacity of N elements that never
+		/// allocates.  Parsing more than N elements into it is an error
+		template<typename T, std::size_t N>
+		using static_vector = inline_vector<T, N, false>;
+
+		/// @brief Default constructor for small_vector/static_vector.  The array
+		/// iterator fills the inline buffer directly
+		template<typename T, std::size_t N, bool AllowHeap>
+		struct default_constructor<inline_vector<T, N, AllowHeap>> {
+			using result_t = inline_vector<T, N, AllowHeap>;
+
+			DAW_ATTRIB_INLINE DAW_JSON_CPP23_STATIC_CALL_OP result_t
+			operator( )( result_t &&v ) DAW_JSON_CPP23_STATIC_CALL_OP_CONST
+			  noexcept( std::is_nothrow_move_constructible_v<result_t> ) {
+				return DAW_MOVE( v );
+			}
+
+			template<typename Iterator>
+			DAW_ATTRIB_INLINE DAW_JSON_CPP23_STATIC_CALL_OP result_t operator( )(
+			  Iterator first, Iterator last ) DAW_JSON_CPP23_STATIC_CALL_OP_CONST {
+				return result_t( first, last );
+			}
+
+			/// @brief Construct from an input range with the number of elements
+			/// counted before parsing.  See options::PrecountArrays
+			template<typename Iterator>
+			DAW_ATTRIB_INLINE DAW_JSON_CPP23_STATIC_CALL_OP result_t
+			operator( )( Iterator first, Iterator last,
+			             std::size_t size_hint ) DAW_JSON_CPP23_STATIC_CALL_OP_CONST {
+				auto result = result_t( );
+				result.reserve( size_hint );
+				result.assign( first, last );
+				return result;
+			}
+		};
+
+		/// @brief Refills a small_vector/static_vector, reusing its capacity
+		template<typename T, std::size_t N, bool AllowHeap>
+		struct reuse_constructor<inline_vector<T, N, AllowHeap>> {
+			template<typename Iterator>
+			DAW_ATTRIB_INLINE DAW_JSON_CPP23_STATIC_CALL_OP void
+			operator( )( inline_vector<T, N, AllowHeap> &v, Iterator first,
+			             Iterator last ) DAW_JSON_CPP23_STATIC_CALL_OP_CONST {
+				v.assign( first, last );
+			}
+		};
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
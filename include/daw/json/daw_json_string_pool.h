@@ -0,0 +1,340 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "impl/version.h"
+
+#include "impl/daw_murmur3.h"
+
+#include <daw/daw_attributes.h>
+#include <daw/daw_string_view.h>
+
+#include <ciso646>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		class string_pool;
+
+		/***
+		 * An allocator that carries a string_pool to the values being parsed.
+		 * Passing it to from_json_alloc, or calling from_json_interned, lets
+		 * interned_string members intern their text.  Memory is allocated with
+		 * std::allocator and it converts to std::allocator<U>, so other types
+		 * that take an allocator are not affected.
+		 */
+		template<typename T>
+		class string_pool_allocator {
+			string_pool *m_pool;
+
+		public:
+			using value_type = T;
+
+			template<typename U>
+			struct rebind {
+				using other = string_pool_allocator<U>;
+			};
+
+			explicit string_pool_allocator( string_pool &pool ) noexcept
+			  : m_pool( &pool ) {}
+
+			template<typename U>
+			string_pool_allocator( string_pool_allocator<U> const &other ) noexcept
+			  : m_pool( &other.pool( ) ) {}
+
+			[[nodiscard]] T *allocate( std::size_t n ) {
+				return std::allocator<T>{ }.allocate( n );
+			}
+
+			void deallocate( T *p, std::size_t n ) noexcept {
+				std::allocator<T>{ }.deallocate( p, n );
+			}
+
+			[[nodiscard]] string_pool &pool( ) const noexcept {
+				return *m_pool;
+			}
+
+			template<typename U>
+			operator std::allocator<U>( ) const noexcept {
+				return std::allocator<U>{ };
+			}
+
+			template<typename U>
+			[[nodiscard]] friend bool
+			operator==( string_pool_allocator const &lhs,
+			            string_pool_allocator<U> const &rhs ) noexcept {
+				return &lhs.pool( ) == &rhs.pool( );
+			}
+
+			template<typename U>
+			[[nodiscard]] friend bool
+			operator!=( string_pool_allocator const &lhs,
+			            string_pool_allocator<U> const &rhs ) noexcept {
+				return &lhs.pool( ) != &rhs.pool( );
+			}
+		};
+
+		/***
+		 * A handle to a string in a string_pool.  It is a string_view that stays
+		 * valid as long as the pool does.  Constructing one while parsing requires
+		 * a string_pool_allocator as the parse allocator, see from_json_interned
+		 */
+		class interned_string {
+			std::string_view m_value{ };
+
+			friend class string_pool;
+
+			explicit interned_string( std::string_view value ) noexcept
+			  : m_value( value ) {}
+
+		public:
+			using value_type = char;
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using const_pointer = char const *;
+			using pointer = const_pointer;
+			using const_iterator = char const *;
+			using iterator = const_iterator;
+			/// @brief The type escaped strings are decoded to before interning
+			using string_type = std::string;
+
+			interned_string( ) = default;
+
+			template<typename T>
+			interned_string( char const *ptr, std::size_t sz,
+			                 string_pool_allocator<T> const &alloc );
+
+			template<typename T>
+			interned_string( char const *first, char const *last,
+			                 string_pool_allocator<T> const &alloc );
+
+			template<typename T>
+			interned_string( std::string_view decoded,
+			                 string_pool_allocator<T> const &alloc );
+
+			[[nodiscard]] char const *data( ) const noexcept {
+				return m_value.data( );
+			}
+
+			[[nodiscard]] std::size_t size( ) const noexcept {
+				return m_value.size( );
+			}
+
+			[[nodiscard]] bool empty( ) const noexcept {
+				return m_value.empty( );
+			}
+
+			[[nodiscard]] const_iterator begin( ) const noexcept {
+				return m_value.data( );
+			}
+
+			[[nodiscard]] const_iterator end( ) const noexcept {
+				return m_value.data( ) + m_value.size( );
+			}
+
+			[[nodiscard]] std::string_view view( ) const noexcept {
+				return m_value;
+			}
+
+			[[nodiscard]] operator std::string_view( ) const noexcept {
+				return m_value;
+			}
+
+			/// @brief Strings from the same pool are equal when they refer to the
+			/// same storage
+			[[nodiscard]] friend bool
+			operator==( interned_string const &lhs,
+			            interned_string const &rhs ) noexcept {
+				return ( lhs.data( ) == rhs.data( ) and lhs.size( ) == rhs.size( ) ) or
+				       lhs.m_value == rhs.m_value;
+			}
+
+			[[nodiscard]] friend bool
+			operator!=( interned_string const &lhs,
+			            interned_string const &rhs ) noexcept {
+				return not( lhs == rhs );
+			}
+
+			[[nodiscard]] friend bool operator==( interned_string const &lhs,
+			                                      std::string_view rhs ) noexcept {
+				return lhs.m_value == rhs;
+			}
+
+			[[nodiscard]] friend bool operator!=( interned_string const &lhs,
+			                                      std::string_view rhs ) noexcept {
+				return lhs.m_value != rhs;
+			}
+		};
+
+		/***
+		 * A table of unique strings.  Each distinct string is stored once and
+		 * interning it again returns the same storage.  Strings are found by
+		 * their murmur3 hash in an open addressed table and their text is kept in
+		 * chunks that are never moved, so the interned_strings stay valid until
+		 * the pool is cleared or destroyed.  Not thread safe.
+		 */
+		class string_pool {
+			struct entry {
+				char const *data = nullptr;
+				std::size_t size = 0;
+				std::uint32_t hash = 0;
+			};
+
+			static constexpr std::size_t initial_table_size = 1024U;
+			static constexpr std::size_t chunk_size = 16U * 1024U;
+
+			std::vector<entry> m_table{ };
+			std::size_t m_count = 0;
+			std::vector<std::unique_ptr<char[]>> m_chunks{ };
+			char *m_ptr = nullptr;
+			std::size_t m_remaining = 0;
+			std::size_t m_bytes = 0;
+
+			[[nodiscard]] static std::uint32_t hash( std::string_view str ) {
+				return static_cast<std::uint32_t>(
+				  daw::murmur3_32( daw::string_view( str.data( ), str.size( ) ) ) );
+			}
+
+			[[nodiscard]] char const *store( std::string_view str ) {
+				if( m_remaining < str.size( ) ) {
+					std::size_t const sz =
+					  str.size( ) > chunk_size ? str.size( ) : chunk_size;
+					m_chunks.push_back( std::make_unique<char[]>( sz ) );
+					m_ptr = m_chunks.back( ).get( );
+					m_remaining = sz;
+				}
+				char *const result = m_ptr;
+				std::memcpy( result, str.data( ), str.size( ) );
+				m_ptr += str.size( );
+				m_remaining -= str.size( );
+				m_bytes += str.size( );
+				return result;
+			}
+
+			DAW_ATTRIB_NOINLINE void grow( ) {
+				auto old_table = std::vector<entry>(
+				  m_table.empty( ) ? initial_table_size : m_table.size( ) * 2U );
+				old_table.swap( m_table );
+				std::size_t const mask = m_table.size( ) - 1U;
+				for( entry const &e : old_table ) {
+					if( e.data == nullptr ) {
+						continue;
+					}
+					std::size_t pos = e.hash & mask;
+					while( m_table[pos].data != nullptr ) {
+						pos = ( pos + 1U ) & mask;
+					}
+					m_table[pos] = e;
+				}
+			}
+
+		public:
+			string_pool( ) = default;
+			string_pool( string_pool const & ) = delete;
+			string_pool &operator=( string_pool const & ) = delete;
+			string_pool( string_pool && ) noexcept = default;
+			string_pool &operator=( string_pool && ) noexcept = default;
+			~string_pool( ) = default;
+
+			/// @brief Find str in the pool, adding it when it is not there
+			[[nodiscard]] interned_string intern( std::string_view str ) {
+				if( str.empty( ) ) {
+					return interned_string( );
+				}
+				if( ( m_count + 1U ) * 2U > m_table.size( ) ) {
+					grow( );
+				}
+				std::uint32_t const h = hash( str );
+				std::size_t const mask = m_table.size( ) - 1U;
+				std::size_t pos = h & mask;
+				while( true ) {
+					entry &e = m_table[pos];
+					if( e.data == nullptr ) {
+						e = entry{ store( str ), str.size( ), h };
+						++m_count;
+						return interned_string( std::string_view( e.data, e.size ) );
+					}
+					if( e.hash == h and e.size == str.size( ) and
+					    std::memcmp( e.data, str.data( ), str.size( ) ) == 0 ) {
+						return interned_string( std::string_view( e.data, e.size ) );
+					}
+					pos = ( pos + 1U ) & mask;
+				}
+			}
+
+			/// @brief The number of distinct strings in the pool
+			[[nodiscard]] std::size_t size( ) const noexcept {
+				return m_count;
+			}
+
+			/// @brief The number of bytes of string data in the pool
+			[[nodiscard]] std::size_t bytes_used( ) const noexcept {
+				return m_bytes;
+			}
+
+			/// @brief Remove all strings.  interned_strings from the pool are no
+			/// longer valid
+			void clear( ) noexcept {
+				m_table.clear( );
+				m_count = 0;
+				m_chunks.clear( );
+				m_ptr = nullptr;
+				m_remaining = 0;
+				m_bytes = 0;
+			}
+
+			template<typename T = char>
+			[[nodiscard]] string_pool_allocator<T> get_allocator( ) noexcept {
+				return string_pool_allocator<T>( *this );
+			}
+		};
+
+		template<typename T>
+		interned_string::interned_string( std::string_view decoded,
+		                                  string_pool_allocator<T> const &alloc )
+		  : m_value( alloc.pool( ).intern( decoded ).view( ) ) {}
+
+		template<typename T>
+		interned_string::interned_string( char const *ptr, std::size_t sz,
+		                                  string_pool_allocator<T> const &alloc )
+		  : interned_string( std::string_view( ptr, sz ), alloc ) {}
+
+		template<typename T>
+		interned_string::interned_string( char const *first, char const *last,
+		                                  string_pool_allocator<T> const &alloc )
+		  : interned_string(
+		      std::string_view( first, static_cast<std::size_t>( last - first ) ),
+		      alloc ) {}
+
+		namespace json_details {
+			template<typename>
+			inline constexpr bool is_interned_string_v = false;
+
+			template<>
+			inline constexpr bool is_interned_string_v<interned_string> = true;
+		} // namespace json_details
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
+
+namespace std {
+	template<>
+	struct hash<daw::json::interned_string> {
+		[[nodiscard]] std::size_t
+		operator( )( daw::json::interned_string const &str ) const noexcept {
+			return std::hash<std::string_view>{ }( str.view( ) );
+		}
+	};
+} // namespace std
@@ -14,6 +14,7 @@
 #include "daw_to_json_fwd.h"
 #include "impl/daw_json_container_appender.h"
 #include "impl/daw_json_link_types_fwd.h"
+#include "impl/daw_json_max_serialized_size.h"
 #include "impl/to_daw_json_string.h"
 
 #include <daw/daw_traits.h>
@@ -61,6 +62,10 @@ namespace daw::json {
 					  options::output_flags_t<PolicyFlags...>::value>( it );
 				}
 			}( );
+			json_details::serialization::date_prefix_cache date_cache{ };
+			if( out_it.date_cache == nullptr ) {
+				out_it.date_cache = &date_cache;
+			}
 			return json_details::member_to_string( template_arg<json_class_t>, out_it,
 			                                       value )
 			  .get( );
@@ -76,6 +81,54 @@ namespace daw::json {
 			return result;
 		}
 
+		template<typename JsonClass, typename Value, typename CharT,
+		         auto... PolicyFlags>
+		constexpr bounded_output<CharT>
+		to_json_bounded( Value const &value, CharT *buffer, std::size_t capacity,
+		                 options::output_flags_t<PolicyFlags...> flgs ) {
+			constexpr std::size_t max_size =
+			  max_serialized_size_v<typename std::conditional_t<
+			                          std::is_same_v<use_default, JsonClass>,
+			                          daw::traits::identity<Value>,
+			                          daw::traits::identity<JsonClass>>::type,
+			                        options::output_flags_t<PolicyFlags...>::value>;
+			if constexpr( max_size != json_details::unbounded_serialized_size ) {
+				if( buffer != nullptr and capacity >= max_size ) {
+					// The output cannot overflow, skip the bounds checks
+					CharT *last = buffer;
+					(void)to_json<JsonClass>( value, last, flgs );
+					return bounded_output<CharT>(
+					  buffer, capacity, static_cast<std::size_t>( last - buffer ) );
+				}
+			}
+			return to_json<JsonClass>(
+			  value, bounded_output<CharT>( buffer, capacity ), flgs );
+		}
+
+		template<typename JsonClass, typename Value, typename Span,
+		         auto... PolicyFlags,
+		         std::enable_if_t<
+		           concepts::writeable_output_details::is_span_like_range_v<
+		             Span, typename Span::value_type>,
+		           std::nullptr_t>>
+		constexpr bounded_output<typename Span::value_type>
+		to_json_bounded( Value const &value, Span buffer,
+		                 options::output_flags_t<PolicyFlags...> flgs ) {
+			return to_json_bounded<JsonClass>( value, buffer.data( ), buffer.size( ),
+			                                   flgs );
+		}
+
+		template<std::size_t InlineCapacity, typename JsonClass, typename Value,
+		         auto... PolicyFlags>
+		small_buffer_output<InlineCapacity>
+		to_json_small( Value const &value,
+		               options::output_flags_t<PolicyFlags...> flgs ) {
+			// Serialize into the named result so that it is not copied on return
+			small_buffer_output<InlineCapacity> result{ };
+			(void)to_json<JsonClass>( value, result, flgs );
+			return result;
+		}
+
 		template<typename JsonElement, typename Container, typename WritableType,
 		         auto... PolicyFlags,
 		         std::enable_if_t<concepts::is_writable_output_type_v<
@@ -109,6 +162,10 @@ namespace daw::json {
 					  options::output_flags_t<PolicyFlags...>::value>( it );
 				}
 			}( );
+			json_details::serialization::date_prefix_cache date_cache{ };
+			if( out_it.date_cache == nullptr ) {
+				out_it.date_cache = &date_cache;
+			}
 			out_it.put( '[' );
 			out_it.add_indent( );
 			// Not const & as some types(vector<bool>::const_reference are not ref
@@ -10,6 +10,7 @@
 
 #include "impl/version.h"
 
+#include "concepts/daw_writable_output.h"
 #include "impl/daw_json_link_types_fwd.h"
 #include "impl/daw_json_serialize_policy.h"
 
@@ -75,6 +76,55 @@ namespace daw::json {
 		inline std::string to_json( Value const &value,
 		                            options::output_flags_t<PolicyFlags...> );
 
+		/// @brief Serialize a value to JSON into a caller owned buffer without
+		/// allocating or throwing when it is too small.  When the type has a
+		/// compile time bound on it's size(see max_serialized_size_v) that fits
+		/// in the buffer, the output is written without any bounds checks.
+		/// @tparam JsonClass Type that has json_parser_description and to_json_data
+		/// function overloads.  Defaults to deducing based on Value
+		/// @param value value to serialize
+		/// @param buffer start of the output buffer
+		/// @param capacity size of the output buffer
+		/// @return A bounded_output with the size written and the size required.
+		/// When truncated( ) is true, required_size( ) is the buffer size needed
+		template<typename JsonClass = use_default, typename Value, typename CharT,
+		         auto... PolicyFlags>
+		constexpr bounded_output<CharT> to_json_bounded(
+		  Value const &value, CharT *buffer, std::size_t capacity,
+		  options::output_flags_t<PolicyFlags...> = options::output_flags<> );
+
+		/// @brief Serialize a value to JSON into a caller owned span like
+		/// buffer(e.g. std::span<char>) without allocating or throwing when it is
+		/// too small
+		/// @tparam JsonClass Type that has json_parser_description and to_json_data
+		/// function overloads.  Defaults to deducing based on Value
+		/// @param value value to serialize
+		/// @param buffer A contiguous range with data( ) and size( ) to write to
+		/// @return A bounded_output with the size written and the size required
+		template<typename JsonClass = use_default, typename Value, typename Span,
+		         auto... PolicyFlags,
+		         std::enable_if_t<
+		           concepts::writeable_output_details::is_span_like_range_v<
+		             Span, typename Span::value_type>,
+		           std::nullptr_t> = nullptr>
+		constexpr bounded_output<typename Span::value_type> to_json_bounded(
+		  Value const &value, Span buffer,
+		  options::output_flags_t<PolicyFlags...> = options::output_flags<> );
+
+		/// @brief Serialize a value to JSON into a small_buffer_output.  Output up
+		/// to InlineCapacity characters is stored in the returned object and does
+		/// not allocate, larger output moves to the heap.
+		/// @tparam InlineCapacity Number of characters stored without allocating
+		/// @tparam JsonClass Type that has json_parser_description and to_json_data
+		/// function overloads.  Defaults to deducing based on Value
+		/// @param value value to serialize
+		/// @return A small_buffer_output with the JSON representation of value
+		template<std::size_t InlineCapacity = 512, typename JsonClass = use_default,
+		         typename Value, auto... PolicyFlags>
+		small_buffer_output<InlineCapacity> to_json_small(
+		  Value const &value,
+		  options::output_flags_t<PolicyFlags...> = options::output_flags<> );
+
 		namespace json_details {
 			/// @brief Tag type to indicate that the element of a Container is not
 			/// being specified.  This is the default.
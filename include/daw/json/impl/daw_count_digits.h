@@ -10,7 +10,9 @@
 
 #include "version.h"
 
+#include <daw/daw_attributes.h>
 #include <daw/daw_cxmath.h>
+#include <daw/daw_likely.h>
 #include <daw/daw_uint_buffer.h>
 
 #include <array>
@@ -20,74 +22,79 @@
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
 		namespace json_details {
-			inline constexpr auto is_digit = []( char c ) -> daw::UInt8 {
-				return static_cast<unsigned>( static_cast<unsigned char>( c ) ) -
-				             static_cast<unsigned>(
-				               static_cast<unsigned char>( '0' ) ) <
-				           10U
-				         ? daw::UInt8{ 0 }
-				         : daw::UInt8{ 0xFFU };
-			};
-
-			template<typename Predicate>
-			DAW_ATTRIB_FLATINLINE inline constexpr std::int32_t
-			count_4digits( char const *first, Predicate pred ) {
-				std::array<daw::UInt8, 4> const buff{
-				  pred( first[3] ), pred( first[2] ), pred( first[2] ),
-				  pred( first[1] ) };
-				auto const v = DAW_BIT_CAST( std::uint32_t, buff );
-				if( v != 0 ) {
-					auto result = daw::cxmath::count_leading_zeroes( v );
-					result /= 8;
-					return static_cast<std::int32_t>( result );
+			/***
+			 * The number of leading characters of the 8 at first that are digits.
+			 * The characters are packed with first[0] in the highest byte so the
+			 * leading zero count of the non-digit mask is the position of the
+			 * first non-digit
+			 */
+			DAW_ATTRIB_INLINE inline constexpr std::int32_t
+			count_leading_digits8( char const *first ) {
+				std::uint64_t val = 0;
+				for( std::size_t n = 0; n < 8; ++n ) {
+					val = ( val << 8U ) |
+					      static_cast<std::uint64_t>(
+					        static_cast<unsigned char>( first[n] ) );
 				}
-				return -1;
-			}
-
-			template<typename Predicate>
-			DAW_ATTRIB_FLATINLINE inline constexpr std::int32_t
-			count_8digits( char const *first, Predicate pred ) {
-				std::array<daw::UInt8, 8> const buff{
-				  pred( first[7] ), pred( first[6] ), pred( first[5] ),
-				  pred( first[4] ), pred( first[3] ), pred( first[2] ),
-				  pred( first[1] ), pred( first[0] ) };
-
-				auto const v = DAW_BIT_CAST( std::uint64_t, buff );
-				if( v != 0 ) {
-					auto result = daw::cxmath::count_leading_zeroes( v );
-					result /= 8;
-					return static_cast<std::int32_t>( result );
+				// Only digits are below 10 after removing the '0' bits, the high bit
+				// of a byte is set in non_digits when it is 10 or more
+				std::uint64_t const t = val ^ 0x3030'3030'3030'3030ULL;
+				std::uint64_t const non_digits =
+				  ( ( ( t & 0x7F7F'7F7F'7F7F'7F7FULL ) + 0x7676'7676'7676'7676ULL ) |
+				    t ) &
+				  0x8080'8080'8080'8080ULL;
+				if( non_digits == 0 ) {
+					return 8;
 				}
-				return -1;
+				return static_cast<std::int32_t>(
+				  daw::cxmath::count_leading_zeroes( non_digits ) / 8U );
 			}
 
+			/***
+			 * @return Pointer to the first character in [first, last) that is not
+			 * a digit, or last
+			 */
 			template<typename CharT>
-			DAW_ATTRIB_FLATTEN inline constexpr CharT *count_digits( CharT *first,
-			                                                         CharT *last ) {
+			DAW_ATTRIB_FLATINLINE inline constexpr CharT *
+			count_digits( CharT *first, CharT *const last ) {
 				while( DAW_LIKELY( last - first >= 8 ) ) {
-					auto const v = count_8digits( first, is_digit );
-					if( v >= 0 ) {
-						return first + v;
+					auto const count = count_leading_digits8( first );
+					first += count;
+					if( count < 8 ) {
+						return first;
 					}
-					first += 8;
 				}
-				while( last - first >= 4 ) {
-					auto const v = count_4digits( first, is_digit );
-					if( v >= 0 ) {
-						return first + v;
-					}
-					first += 4;
+				while( first < last and
+				       static_cast<unsigned>( static_cast<unsigned char>( *first ) ) -
+				           static_cast<unsigned>( static_cast<unsigned char>( '0' ) ) <
+				         10U ) {
+					++first;
 				}
+				return first;
+			}
 
-				while( first != last ) {
-					if( static_cast<unsigned>( *first ) -
-					      static_cast<unsigned>( static_cast<unsigned char>( '0' ) ) >=
-					    10U ) {
-						return first;
+			/// @brief Count the number of base 10 digits needed to represent v.
+			/// Zero is a single digit
+			template<typename Unsigned>
+			DAW_ATTRIB_INLINE inline constexpr std::size_t
+			count_base10_digits( Unsigned v ) {
+				std::size_t result = 1;
+				while( true ) {
+					if( v < 10U ) {
+						return result;
 					}
-					++first;
+					if( v < 100U ) {
+						return result + 1;
+					}
+					if( v < 1000U ) {
+						return result + 2;
+					}
+					if( v < 10000U ) {
+						return result + 3;
+					}
+					v /= 10000U;
+					result += 4;
 				}
-				return first;
 			}
 		} // namespace json_details
 	}   // namespace DAW_JSON_VER
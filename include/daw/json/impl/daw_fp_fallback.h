@@ -23,9 +23,9 @@ namespace daw::json {
 	inline namespace DAW_JSON_VER {
 		namespace json_details {
 			/// @brief When normal FP parsing cannot handle the value, this method
-			/// used as a fallback for std floating point types.  For others, it
-			/// provides either a customization point or will call the overload found
-			/// via ADL
+			/// used as a fallback for std floating point types other than float and
+			/// double, those use parse_real_slow.  For others, it provides either a
+			/// customization point or will call the overload found via ADL
 			template<typename Real>
 			DAW_ATTRIB_NOINLINE [[nodiscard]] Real
 			parse_with_strtod( char const *first, char const *last ) {
@@ -107,7 +107,7 @@ namespace daw::json {
 		};
 
 		/// @brief Default constructor type for std::vector.  It will reserve up
-		/// front for non-random iterators
+		/// front for non-random iterators, exactly when the size is supplied
 		template<typename T, typename Alloc>
 		struct default_constructor<std::vector<T, Alloc>> {
 
@@ -139,6 +139,20 @@ namespace daw::json {
 					return result;
 				}
 			}
+
+			/// @brief Construct from an input range with the number of elements
+			/// counted before parsing.  See options::PrecountArrays
+			template<typename Iterator>
+			DAW_ATTRIB_INLINE
+			  DAW_JSON_CPP23_STATIC_CALL_OP DAW_JSON_CX_VECTOR std::vector<T, Alloc>
+			  operator( )( Iterator first, Iterator last, std::size_t size_hint,
+			               Alloc const &alloc = Alloc{ } )
+			    DAW_JSON_CPP23_STATIC_CALL_OP_CONST {
+				auto result = std::vector<T, Alloc>( alloc );
+				result.reserve( size_hint );
+				result.assign( first, last );
+				return result;
+			}
 		};
 
 		/// @brief default constructor for std::unordered_map.  Allows construction
@@ -169,6 +183,50 @@ namespace daw::json {
 				return std::unordered_map<Key, T, Hash, CompareEqual, Alloc>(
 				  first, last, count, Hash{ }, CompareEqual{ }, alloc );
 			}
+
+			/// @brief Construct with enough buckets for the number of members
+			/// counted before parsing, so that there is no rehashing.  See
+			/// options::PrecountArrays
+			template<typename Iterator>
+			DAW_ATTRIB_INLINE DAW_JSON_CPP23_STATIC_CALL_OP
+			  std::unordered_map<Key, T, Hash, CompareEqual, Alloc>
+			  operator( )( Iterator first, Iterator last, std::size_t size_hint,
+			               Alloc const &alloc = Alloc{ } )
+			    DAW_JSON_CPP23_STATIC_CALL_OP_CONST {
+				auto result = std::unordered_map<Key, T, Hash, CompareEqual, Alloc>(
+				  count, Hash{ }, CompareEqual{ }, alloc );
+				result.reserve( size_hint );
+				result.insert( first, last );
+				return result;
+			}
+		};
+
+		/// @brief Refills a std::vector, reusing its capacity
+		template<typename T, typename Alloc>
+		struct reuse_constructor<std::vector<T, Alloc>> {
+			template<typename Iterator>
+			DAW_ATTRIB_INLINE DAW_JSON_CPP23_STATIC_CALL_OP DAW_JSON_CX_VECTOR auto
+			operator( )( std::vector<T, Alloc> &v, Iterator first, Iterator last )
+			  DAW_JSON_CPP23_STATIC_CALL_OP_CONST
+			  -> decltype( v.assign( first, last ) ) {
+				return v.assign( first, last );
+			}
+		};
+
+		/// @brief Refills a std::unordered_map, reusing its buckets
+		template<typename Key, typename T, typename Hash, typename CompareEqual,
+		         typename Alloc>
+		struct reuse_constructor<
+		  std::unordered_map<Key, T, Hash, CompareEqual, Alloc>> {
+			template<typename Iterator>
+			DAW_ATTRIB_INLINE DAW_JSON_CPP23_STATIC_CALL_OP auto
+			operator( )( std::unordered_map<Key, T, Hash, CompareEqual, Alloc> &m,
+			             Iterator first, Iterator last )
+			  DAW_JSON_CPP23_STATIC_CALL_OP_CONST
+			  -> decltype( m.insert( first, last ) ) {
+				m.clear( );
+				return m.insert( first, last );
+			}
 		};
 
 		/// @brief Default constructor for readable nullable types.
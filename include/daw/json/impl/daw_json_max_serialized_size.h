@@ -0,0 +1,186 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include "daw_json_link_types_fwd.h"
+#include "daw_json_parse_common.h"
+#include "daw_json_serialize_options_impl.h"
+#include "to_daw_json_string.h"
+
+#include <daw/daw_consteval.h>
+#include <daw/daw_traits.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			/// @brief Result of max_serialized_size when the size of the output
+			/// depends on the runtime value(e.g. strings and arrays)
+			inline constexpr std::size_t unbounded_serialized_size =
+			  daw::numeric_limits<std::size_t>::max( );
+
+			DAW_ATTRIB_INLINE constexpr std::size_t
+			serialized_size_add( std::size_t lhs, std::size_t rhs ) {
+				if( lhs == unbounded_serialized_size or
+				    rhs == unbounded_serialized_size ) {
+					return unbounded_serialized_size;
+				}
+				return lhs + rhs;
+			}
+
+			template<typename JsonMember>
+			DAW_CONSTEVAL std::size_t max_serialized_size( );
+
+			template<typename T>
+			using json_member_list_pack_t =
+			  typename T::json_member_list::i_am_a_json_member_list;
+
+			template<typename T>
+			using json_tuple_member_list_test =
+			  typename T::json_member_list::i_am_a_json_tuple_member_list;
+
+			template<typename>
+			struct max_class_serialized_size {
+				static constexpr std::size_t value = unbounded_serialized_size;
+			};
+
+			/// @brief A class is {"name":value,...}.  The trailing comma is included
+			/// so that the bound holds when OutputTrailingComma is set
+			template<typename... JsonMembers>
+			struct max_class_serialized_size<daw::fwd_pack<JsonMembers...>> {
+				static DAW_CONSTEVAL std::size_t calc( ) {
+					if constexpr( ( has_dependent_member_v<JsonMembers> or ... ) ) {
+						return unbounded_serialized_size;
+					} else {
+						std::size_t result = 2U + sizeof...( JsonMembers );
+						// "name": is the name plus 3 characters
+						std::size_t const sizes[] = {
+						  serialized_size_add( JsonMembers::name.size( ) + 3U,
+						                       max_serialized_size<JsonMembers>( ) )...,
+						  0U };
+						for( auto sz : sizes ) {
+							result = serialized_size_add( result, sz );
+						}
+						return result;
+					}
+				}
+				static constexpr std::size_t value = calc( );
+			};
+
+			template<typename Real>
+			DAW_CONSTEVAL std::size_t max_real_serialized_size(
+			  options::FPOutputFormat fp_output_format ) {
+				using limits = std::numeric_limits<Real>;
+				// sign, significand digits, decimal point, e, exponent sign and digits
+				std::size_t result = 1U + limits::max_digits10 + 1U + 2U + 4U;
+				if( fp_output_format == options::FPOutputFormat::Decimal ) {
+					// The decimal form pads with zeros in place of the exponent
+					std::size_t const max_zeros =
+					  (std::max)( static_cast<std::size_t>( limits::max_exponent10 ),
+					              static_cast<std::size_t>( -limits::min_exponent10 ) +
+					                limits::max_digits10 );
+					result = 3U + limits::max_digits10 + max_zeros;
+				}
+				// "-Infinity"
+				return (std::max)( result, std::size_t{ 11U } );
+			}
+
+			/***
+			 * Calculate an upper bound on the number of characters to_json can
+			 * write for JsonMember when the output is minified.  Types without a
+			 * fixed shape, like strings and arrays, are unbounded
+			 */
+			template<typename JsonMember>
+			DAW_CONSTEVAL std::size_t max_serialized_size( ) {
+				constexpr JsonParseTypes tag = JsonMember::expected_type;
+				if constexpr( tag == JsonParseTypes::Bool ) {
+					return JsonMember::literal_as_string ==
+					           options::LiteralAsStringOpt::Always
+					         ? 7U
+					         : 5U;
+				} else if constexpr( tag == JsonParseTypes::Signed or
+				                     tag == JsonParseTypes::Unsigned ) {
+					using int_type =
+					  base_int_type_t<typename JsonMember::wrapped_type>;
+					constexpr std::size_t quotes =
+					  JsonMember::literal_as_string ==
+					      options::LiteralAsStringOpt::Always
+					    ? 2U
+					    : 0U;
+					if constexpr( daw::is_integral_v<int_type> ) {
+						return static_cast<std::size_t>(
+						         daw::numeric_limits<int_type>::digits10 ) +
+						       2U + quotes;
+					} else {
+						return unbounded_serialized_size;
+					}
+				} else if constexpr( tag == JsonParseTypes::Real ) {
+					using real_type = typename JsonMember::wrapped_type;
+					if constexpr( daw::is_floating_point_v<real_type> ) {
+						return max_real_serialized_size<real_type>(
+						         JsonMember::fp_output_format ) +
+						       2U;
+					} else {
+						return unbounded_serialized_size;
+					}
+				} else if constexpr( tag == JsonParseTypes::Null ) {
+					return (std::max)(
+					  std::size_t{ 4U },
+					  max_serialized_size<typename JsonMember::member_type>( ) );
+				} else if constexpr( tag == JsonParseTypes::Class ) {
+					if constexpr( daw::is_detected_v<json_tuple_member_list_test,
+					                                 JsonMember> ) {
+						return unbounded_serialized_size;
+					} else {
+						return max_class_serialized_size<
+						  json_member_list_pack_t<JsonMember>>::value;
+					}
+				} else {
+					return unbounded_serialized_size;
+				}
+			}
+
+			template<typename JsonMember, json_options_t SerializationOptions>
+			inline constexpr std::size_t max_serialized_size_for_v = [] {
+				if constexpr( serialization::get_bits_for<
+				                options::SerializationFormat>(
+				                SerializationOptions ) !=
+				              options::SerializationFormat::Minified ) {
+					// Indentation depends on the depth the value is written at
+					return unbounded_serialized_size;
+				} else {
+					return max_serialized_size<JsonMember>( );
+				}
+			}( );
+		} // namespace json_details
+
+		/// @brief An upper bound on the size of the JSON document to_json can
+		/// produce for a T.  Only fixed shape types(numbers, bools, and classes
+		/// made of them) with minified output have a bound.
+		/// @return The bound or unbounded_serialized_size when there is none
+		template<typename T, json_options_t SerializationOptions =
+		                       json_details::serialization::default_policy_flag>
+		inline constexpr std::size_t max_serialized_size_v =
+		  json_details::max_serialized_size_for_v<
+		    json_details::json_deduced_type<T>, SerializationOptions>;
+
+		/// @brief Does T have a compile time bound on it's serialized size
+		template<typename T, json_options_t SerializationOptions =
+		                       json_details::serialization::default_policy_flag>
+		inline constexpr bool has_max_serialized_size_v =
+		  max_serialized_size_v<T, SerializationOptions> !=
+		  json_details::unbounded_serialized_size;
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
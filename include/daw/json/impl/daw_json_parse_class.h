@@ -174,6 +174,20 @@ namespace daw::json {
 				parse_state.set_class_position( old_class_pos );
 			}
 
+			/***
+			 * json_tagged_variant and json_sized_array members find their tag or
+			 * size by scanning their class again from the start
+			 */
+			template<typename JsonMember>
+			[[nodiscard]] static constexpr bool rescans_class( ) {
+				if constexpr( is_json_nullable_v<JsonMember> ) {
+					return rescans_class<typename JsonMember::member_type>( );
+				} else {
+					return JsonMember::expected_type == JsonParseTypes::VariantTagged or
+					       JsonMember::expected_type == JsonParseTypes::SizedArray;
+				}
+			}
+
 			///
 			/// @brief Parse to the user supplied class.  The parser will run
 			/// left->right if it can when the JSON document's order matches that of
@@ -194,6 +208,20 @@ namespace daw::json {
 				    ? AllMembersMustExist::yes
 				    : AllMembersMustExist::no )>;
 
+				if constexpr( ParseState::unescape_in_place and
+				              ( rescans_class<JsonMembers>( ) or ... ) ) {
+					// A string decoded in place before the rescan may no longer skip as
+					// a JSON string, e.g. when it decodes to a quote.  See
+					// options::UnescapeInPlace
+					auto parse_state2 = without_unescape_in_place( parse_state );
+					auto const run_after_parse = daw::on_exit_success( [&] {
+						parse_state.first += parse_state2.first - parse_state.first;
+					} );
+					(void)run_after_parse;
+					return parse_json_class<JsonClass, JsonMembers...>(
+					  parse_state2, std::index_sequence<Is...>{ } );
+				}
+
 				parse_state.trim_left( );
 				// TODO, use member name
 				daw_json_assert_weak( parse_state.is_opening_brace_checked( ),
@@ -297,6 +325,20 @@ namespace daw::json {
 				  std::is_invocable_v<Constructor, typename JsonMembers::parse_to_t...>,
 				  "Supplied types cannot be used for construction of this type" );
 
+				if constexpr( ParseState::unescape_in_place and
+				              ( rescans_class<
+				                  ordered_member_subtype_t<JsonMembers>>( ) or
+				                ... ) ) {
+					// See parse_json_class
+					auto parse_state2 = without_unescape_in_place( parse_state );
+					auto const run_after_parse = daw::on_exit_success( [&] {
+						parse_state.first += parse_state2.first - parse_state.first;
+					} );
+					(void)run_after_parse;
+					return parse_json_tuple_class(
+					  template_args<JsonClass, JsonMembers...>, parse_state2 );
+				}
+
 				parse_state.trim_left( ); // Move to array start '['
 				daw_json_assert_weak( parse_state.is_opening_bracket_checked( ),
 				                      ErrorReason::InvalidArrayStart, parse_state );
@@ -12,6 +12,8 @@
 
 #include "../../daw_allocator_construct.h"
 #include "../concepts/daw_container_traits.h"
+#include "../daw_json_borrowed_string.h"
+#include "../daw_json_string_pool.h"
 #include "daw_json_assert.h"
 #include "daw_json_enums.h"
 #include "daw_json_exec_modes.h"
@@ -480,6 +482,24 @@ namespace daw::json {
 				static constexpr bool type_map_found = true;
 			};
 
+			template<typename Allocator>
+			struct json_deduced_type_map<basic_borrowed_string<Allocator>> {
+				static constexpr bool is_null = false;
+				static constexpr JsonParseTypes parse_type =
+				  JsonParseTypes::StringEscaped;
+
+				static constexpr bool type_map_found = true;
+			};
+
+			template<>
+			struct json_deduced_type_map<interned_string> {
+				static constexpr bool is_null = false;
+				static constexpr JsonParseTypes parse_type =
+				  JsonParseTypes::StringEscaped;
+
+				static constexpr bool type_map_found = true;
+			};
+
 			template<>
 			struct json_deduced_type_map<bool> {
 				static constexpr bool is_null = false;
@@ -0,0 +1,347 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#pragma once
+
+#include "version.h"
+
+#include "../daw_json_default_constuctor_fwd.h"
+#include "../daw_json_link_types.h"
+#include "daw_json_assert.h"
+#include "daw_json_location_info.h"
+#include "daw_json_parse_class.h"
+#include "daw_json_parse_common.h"
+#include "daw_json_parse_value.h"
+
+#include <daw/daw_traits.h>
+
+#include <ciso646>
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/***
+ * Parsing into an existing value, see from_json_into.  Classes are filled
+ * through the mutable references returned by their to_json_data, strings and
+ * containers are refilled so that they keep their capacity, and everything
+ * else, including the elements of containers, is assigned a newly parsed value
+ */
+namespace daw::json {
+	inline namespace DAW_JSON_VER {
+		namespace json_details {
+			template<typename JsonMember, bool KnownBounds, typename ParseState>
+			static constexpr void parse_value_into( ParseState &parse_state,
+			                                        json_result<JsonMember> &out );
+
+			template<typename>
+			inline constexpr bool is_std_string_v = false;
+
+			template<typename Traits, typename Alloc>
+			inline constexpr bool
+			  is_std_string_v<std::basic_string<char, Traits, Alloc>> = true;
+
+			/// @brief Is the member constructed with the default constructor of
+			/// its result, which makes refilling it the same as constructing it
+			template<typename JsonMember>
+			[[nodiscard]] constexpr bool uses_default_constructor( ) {
+				if constexpr( daw::is_detected_v<json_member_constructor_t,
+				                                 JsonMember> ) {
+					return std::is_same_v<typename JsonMember::constructor_t,
+					                      default_constructor<json_result<JsonMember>>>;
+				} else {
+					return false;
+				}
+			}
+
+			///
+			/// @brief Parse a member from a json_class into out.  This is
+			/// parse_class_member with the value written to an existing member
+			///
+			template<std::size_t member_position, typename JsonMember,
+			         AllMembersMustExist must_exist, bool NeedsClassPositions,
+			         typename ParseState, std::size_t N, typename CharT, bool B>
+			DAW_ATTRIB_INLINE static constexpr void
+			parse_class_member_into( ParseState &parse_state,
+			                         locations_info_t<N, CharT, B> &locations,
+			                         json_result<JsonMember> &out ) {
+				parse_state.move_next_member_or_end( );
+
+				daw_json_assert_weak( parse_state.is_at_next_class_member( ),
+				                      ErrorReason::MissingMemberNameOrEndOfClass,
+				                      parse_state );
+
+				auto [loc, known] = find_class_member<member_position, must_exist>(
+				  parse_state, locations, is_json_nullable_v<JsonMember>,
+				  JsonMember::name );
+
+				if( not known ) {
+					if constexpr( NeedsClassPositions ) {
+						auto const cf = parse_state.class_first;
+						auto const cl = parse_state.class_last;
+						parse_value_into<without_name<JsonMember>, false>( parse_state,
+						                                                  out );
+						parse_state.class_first = cf;
+						parse_state.class_last = cl;
+					} else {
+						parse_value_into<without_name<JsonMember>, false>( parse_state,
+						                                                  out );
+					}
+					return;
+				}
+				if( loc.is_null( ) ) {
+					if constexpr( is_json_nullable_v<JsonMember> ) {
+						out = parse_value_null<without_name<JsonMember>, true>( loc );
+						return;
+					} else {
+						daw_json_error( missing_member( std::string_view(
+						                  std::data( JsonMember::name ),
+						                  std::size( JsonMember::name ) ) ),
+						                parse_state );
+					}
+				}
+				// Member was previously skipped
+				parse_value_into<without_name<JsonMember>, true>( loc, out );
+			}
+
+			/***
+			 * A class can be parsed into when its to_json_data, called with a
+			 * mutable value, returns mutable references to members with the types
+			 * that the member list parses to, and it does not have its own
+			 * constructor.  A to_json_data that only takes a const value returns
+			 * const references, and the class is assigned instead
+			 */
+			template<typename T, typename MemberList>
+			struct class_into_traits {
+				static constexpr bool value = false;
+			};
+
+			template<typename T, typename... JsonMembers>
+			struct class_into_traits<T, json_member_list<JsonMembers...>> {
+				using refs_t = daw::remove_cvref_t<json_parser_to_json_data_t<T>>;
+
+				template<std::size_t I, typename JsonMember>
+				static constexpr bool is_member_ref( ) {
+					using ref_t = std::tuple_element_t<I, refs_t>;
+					return std::is_lvalue_reference_v<ref_t> and
+					       not std::is_const_v<std::remove_reference_t<ref_t>> and
+					       std::is_same_v<daw::remove_cvref_t<ref_t>,
+					                      json_result<JsonMember>>;
+				}
+
+				template<std::size_t... Is>
+				static constexpr bool are_member_refs( std::index_sequence<Is...> ) {
+					return ( is_member_ref<Is, JsonMembers>( ) and ... );
+				}
+
+				static constexpr bool get_value( ) {
+					if constexpr( std::tuple_size_v<refs_t> !=
+					              sizeof...( JsonMembers ) ) {
+						return false;
+					} else {
+						return are_member_refs(
+						  std::index_sequence_for<JsonMembers...>{ } );
+					}
+				}
+
+				static constexpr bool value = get_value( );
+
+				/// @brief Parse the members into the references of out.  This is
+				/// parse_json_class without the construction
+				template<typename ParseState, std::size_t... Is>
+				static constexpr void parse( ParseState &parse_state, T &out,
+				                             std::index_sequence<Is...> ) {
+					if constexpr( ParseState::unescape_in_place and
+					              ( rescans_class<JsonMembers>( ) or ... ) ) {
+						// See parse_json_class
+						auto parse_state2 = without_unescape_in_place( parse_state );
+						parse( parse_state2, out, std::index_sequence<Is...>{ } );
+						parse_state.first += parse_state2.first - parse_state.first;
+					} else {
+						parse_state.trim_left( );
+						daw_json_assert_weak( parse_state.is_opening_brace_checked( ),
+						                      ErrorReason::InvalidClassStart, parse_state );
+
+						auto const old_class_pos = parse_state.get_class_position( );
+						parse_state.set_class_position( );
+						parse_state.remove_prefix( );
+						parse_state.trim_left( );
+
+						if constexpr( sizeof...( JsonMembers ) > 0 ) {
+							parse_members( parse_state, out, std::index_sequence<Is...>{ } );
+						}
+						class_cleanup_now<
+						  json_details::all_json_members_must_exist_v<T, ParseState>>(
+						  parse_state, old_class_pos );
+					}
+				}
+
+				template<typename ParseState, std::size_t... Is>
+				static constexpr void parse_members( ParseState &parse_state, T &out,
+				                                     std::index_sequence<Is...> ) {
+					using must_exist = daw::constant<(
+					  json_details::all_json_members_must_exist_v<T, ParseState>
+					    ? AllMembersMustExist::yes
+					    : AllMembersMustExist::no )>;
+					using NeedClassPositions = std::bool_constant<(
+					  ( JsonMembers::must_be_class_member or ... ) )>;
+
+#if defined( DAW_JSON_BUGFIX_MSVC_KNOWN_LOC_ICE_003 )
+					auto known_locations =
+					  make_locations_info<ParseState, JsonMembers...>( );
+#else
+					auto known_locations = DAW_AS_CONSTANT(
+					  ( make_locations_info<ParseState, JsonMembers...>( ) ) );
+#endif
+					auto refs = json_data_contract<T>::to_json_data( out );
+					( parse_class_member_into<Is, traits::nth_type<Is, JsonMembers...>,
+					                          must_exist::value,
+					                          NeedClassPositions::value>(
+					    parse_state, known_locations, std::get<Is>( refs ) ),
+					  ... );
+				}
+			};
+
+			template<typename T>
+			[[nodiscard]] constexpr bool can_parse_class_into( ) {
+				if constexpr( not has_json_data_contract_trait_v<T> or
+				              not has_json_to_json_data_v<T> ) {
+					return false;
+				} else if constexpr( has_data_contract_constructor_v<T> or
+				                     is_pinned_type_v<T> ) {
+					return false;
+				} else {
+					return class_into_traits<T, json_data_contract_trait_t<T>>::value;
+				}
+			}
+
+			template<typename JsonMember, bool KnownBounds, typename ParseState>
+			[[nodiscard]] constexpr bool can_reuse_array( ) {
+				if constexpr( JsonMember::expected_type != JsonParseTypes::Array or
+				              not uses_default_constructor<JsonMember>( ) ) {
+					return false;
+				} else {
+					using iterator_t =
+					  json_parse_array_iterator<JsonMember, ParseState,
+					                            can_be_random_iterator_v<KnownBounds>>;
+					return std::is_invocable_v<reuse_constructor<json_result<JsonMember>>,
+					                           json_result<JsonMember> &, iterator_t,
+					                           iterator_t>;
+				}
+			}
+
+			template<typename JsonMember, bool KnownBounds, typename ParseState>
+			[[nodiscard]] constexpr bool can_reuse_keyvalue( ) {
+				if constexpr( JsonMember::expected_type != JsonParseTypes::KeyValue or
+				              not uses_default_constructor<JsonMember>( ) ) {
+					return false;
+				} else {
+					using iterator_t =
+					  json_parse_kv_class_iterator<JsonMember, ParseState,
+					                               can_be_random_iterator_v<KnownBounds>>;
+					return std::is_invocable_v<reuse_constructor<json_result<JsonMember>>,
+					                           json_result<JsonMember> &, iterator_t,
+					                           iterator_t>;
+				}
+			}
+
+			template<typename JsonMember, typename ParseState>
+			[[nodiscard]] constexpr bool can_reuse_string( ) {
+				if constexpr( JsonMember::expected_type !=
+				                JsonParseTypes::StringEscaped or
+				              ParseState::unescape_in_place ) {
+					return false;
+				} else {
+					return is_std_string_v<json_result<JsonMember>> and
+					       uses_default_constructor<JsonMember>( );
+				}
+			}
+
+			template<typename JsonMember>
+			[[nodiscard]] constexpr bool can_reuse_class( ) {
+				if constexpr( JsonMember::expected_type != JsonParseTypes::Class ) {
+					return false;
+				} else {
+					return uses_default_constructor<JsonMember>( ) and
+					       can_parse_class_into<json_result<JsonMember>>( );
+				}
+			}
+
+			/***
+			 * Parse the value at parse_state into out.  Classes, strings, arrays
+			 * and key values with the default constructors are refilled, anything
+			 * else is assigned a newly parsed value
+			 */
+			template<typename JsonMember, bool KnownBounds, typename ParseState>
+			static constexpr void parse_value_into( ParseState &parse_state,
+			                                        json_result<JsonMember> &out ) {
+				using value_t = json_result<JsonMember>;
+				if constexpr( can_reuse_class<JsonMember>( ) ) {
+					daw_json_assert_weak( parse_state.has_more( ),
+					                      ErrorReason::UnexpectedEndOfData, parse_state );
+					using traits_t =
+					  class_into_traits<value_t, json_data_contract_trait_t<value_t>>;
+					traits_t::parse(
+					  parse_state, out,
+					  std::make_index_sequence<std::tuple_size_v<
+					    typename traits_t::refs_t>>{ } );
+					if constexpr( not KnownBounds ) {
+						parse_state.trim_left_checked( );
+					}
+				} else if constexpr( can_reuse_string<JsonMember, ParseState>( ) ) {
+					using AllowHighEightbits =
+					  std::bool_constant<JsonMember::eight_bit_mode !=
+					                     options::EightBitModes::DisallowHigh>;
+					auto parse_state2 =
+					  KnownBounds ? parse_state : skip_string( parse_state );
+					if( not AllowHighEightbits::value or
+					    needs_slow_path( parse_state2 ) ) {
+						// The decoded string is never longer than the escaped one
+						out.resize( std::size( parse_state2 ) );
+						char *const last =
+						  unescape_string_to<AllowHighEightbits::value, true, false>(
+						    parse_state2, std::data( out ) );
+						out.resize( static_cast<std::size_t>( last - std::data( out ) ) );
+					} else {
+						out.assign( std::data( parse_state2 ),
+						            daw::data_end( parse_state2 ) );
+					}
+				} else if constexpr( can_reuse_array<JsonMember, KnownBounds,
+				                                     ParseState>( ) ) {
+					parse_state.trim_left( );
+					daw_json_assert_weak( parse_state.is_opening_bracket_checked( ),
+					                      ErrorReason::InvalidArrayStart, parse_state );
+					using iterator_t =
+					  json_parse_array_iterator<JsonMember, ParseState,
+					                            can_be_random_iterator_v<KnownBounds>>;
+					parse_state.remove_prefix( );
+					parse_state.trim_left_unchecked( );
+					reuse_constructor<value_t>{ }( out, iterator_t( parse_state ),
+					                               iterator_t( ) );
+				} else if constexpr( can_reuse_keyvalue<JsonMember, KnownBounds,
+				                                        ParseState>( ) ) {
+					parse_state.trim_left( );
+					daw_json_assert_weak( parse_state.is_opening_brace_checked( ),
+					                      ErrorReason::ExpectedKeyValueToStartWithBrace,
+					                      parse_state );
+					using iterator_t =
+					  json_parse_kv_class_iterator<JsonMember, ParseState,
+					                               can_be_random_iterator_v<KnownBounds>>;
+					parse_state.remove_prefix( );
+					parse_state.trim_left( );
+					reuse_constructor<value_t>{ }( out, iterator_t( parse_state ),
+					                               iterator_t( ) );
+				} else {
+					out = parse_value<JsonMember, KnownBounds>(
+					  parse_state, ParseTag<JsonMember::expected_type>{ } );
+				}
+			}
+		} // namespace json_details
+	} // namespace DAW_JSON_VER
+} // namespace daw::json
@@ -223,10 +223,139 @@ namespace daw::json {
 				return result;
 			}
 
+			namespace datetime_details {
+				/// @brief The byte masks of an 8 character layout.  '#' is a digit and
+				/// any other character must match exactly
+				struct swar_layout {
+					std::uint64_t digit_mask;
+					std::uint64_t separator_mask;
+					std::uint64_t separators;
+				};
+
+				template<std::size_t N>
+				constexpr swar_layout make_swar_layout( char const ( &layout )[N] ) {
+					static_assert( N == 9, "A layout is 8 characters" );
+					auto result = swar_layout{ 0, 0, 0 };
+					for( std::size_t n = 0; n < 8; ++n ) {
+						auto const byte_mask = std::uint64_t{ 0xFFU } << ( 8U * n );
+						if( layout[n] == '#' ) {
+							result.digit_mask |= byte_mask;
+						} else {
+							result.separator_mask |= byte_mask;
+							result.separators |=
+							  std::uint64_t{ static_cast<unsigned char>( layout[n] ) }
+							  << ( 8U * n );
+						}
+					}
+					return result;
+				}
+
+				/// @brief The 8 characters at ptr, the first in the lowest byte
+				constexpr std::uint64_t load_8_chars( char const *ptr ) {
+					return static_cast<std::uint64_t>( daw::to_uint64_buffer( ptr ) );
+				}
+
+				/// @brief Are the digit positions of chunk '0'-'9' and the others the
+				/// separators of layout
+				constexpr bool matches_layout( std::uint64_t chunk,
+				                               swar_layout const &layout ) {
+					// Put '0' in the separator positions so that all 8 bytes can be
+					// checked as digits at once
+					std::uint64_t const digits =
+					  ( chunk & layout.digit_mask ) |
+					  ( 0x3030'3030'3030'3030ULL & layout.separator_mask );
+					bool const are_digits =
+					  ( ( digits & 0xF0F0'F0F0'F0F0'F0F0ULL ) |
+					    ( ( ( digits + 0x0606'0606'0606'0606ULL ) &
+					        0xF0F0'F0F0'F0F0'F0F0ULL ) >>
+					      4U ) ) == 0x3333'3333'3333'3333ULL;
+					return are_digits &
+					       ( ( chunk & layout.separator_mask ) == layout.separators );
+				}
+
+				/***
+				 * The two digit number starting at each byte, 10 * b[n] + b[n + 1].
+				 * Every one fits in its byte, so they are all calculated with one
+				 * multiply-add
+				 */
+				constexpr std::uint64_t digit_pairs( std::uint64_t chunk ) {
+					std::uint64_t const d = chunk & 0x0F0F'0F0F'0F0F'0F0FULL;
+					return d * 10U + ( d >> 8U );
+				}
+
+				constexpr std::uint_least32_t pair_at( std::uint64_t pairs,
+				                                       unsigned n ) {
+					return static_cast<std::uint_least32_t>( ( pairs >> ( 8U * n ) ) &
+					                                         0xFFU );
+				}
+
+				inline constexpr auto layout_date = make_swar_layout( "####-##-" );
+				inline constexpr auto layout_day_time = make_swar_layout( "##T##:##" );
+				inline constexpr auto layout_second_ms =
+				  make_swar_layout( ":##.###Z" );
+				// The last 8 characters when there are no milliseconds
+				inline constexpr auto layout_second = make_swar_layout( "#:##:##Z" );
+
+				/***
+				 * Parse the canonical YYYY-MM-DDTHH:MM:SS.mmmZ and
+				 * YYYY-MM-DDTHH:MM:SSZ layouts 8 characters at a time.  Each block is
+				 * validated against its layout with masks and its two digit fields
+				 * are converted together
+				 * @return false when ts is not in one of those layouts
+				 */
+				constexpr bool parse_iso8601_canonical( char const *ptr,
+				                                        std::size_t sz,
+				                                        date_parts &ymd,
+				                                        time_parts &hms ) {
+					bool const has_ms = sz == 24;
+					if( not has_ms and sz != 20 ) {
+						return false;
+					}
+					std::uint64_t const c0 = load_8_chars( ptr );
+					std::uint64_t const c1 = load_8_chars( ptr + 8 );
+					std::uint64_t const c2 = load_8_chars( ptr + sz - 8 );
+					if( not( matches_layout( c0, layout_date ) &
+					         matches_layout( c1, layout_day_time ) &
+					         matches_layout( c2, has_ms ? layout_second_ms
+					                                    : layout_second ) ) ) {
+						return false;
+					}
+					std::uint64_t const p0 = digit_pairs( c0 );
+					std::uint64_t const p1 = digit_pairs( c1 );
+					std::uint64_t const p2 = digit_pairs( c2 );
+					ymd.year = static_cast<std::int_least32_t>( pair_at( p0, 0 ) * 100U +
+					                                            pair_at( p0, 2 ) );
+					ymd.month = pair_at( p0, 5 );
+					ymd.day = pair_at( p1, 0 );
+					hms.hour = pair_at( p1, 3 );
+					hms.minute = pair_at( p1, 6 );
+					if( has_ms ) {
+						hms.second = pair_at( p2, 1 );
+						hms.millisecond =
+						  pair_at( p2, 4 ) * 10U +
+						  static_cast<std::uint_least32_t>( ( c2 >> 48U ) & 0x0FU );
+					} else {
+						hms.second = pair_at( p2, 5 );
+						hms.millisecond = 0;
+					}
+					return true;
+				}
+			} // namespace datetime_details
+
 			template<string_view_bounds_type Bounds>
 			constexpr std::chrono::time_point<std::chrono::system_clock,
 			                                  std::chrono::milliseconds>
 			parse_iso8601_timestamp( daw::basic_string_view<char, Bounds> ts ) {
+				{
+					auto ymd = date_parts{ 0, 0, 0 };
+					auto hms = time_parts{ 0, 0, 0, 0 };
+					if( datetime_details::parse_iso8601_canonical(
+					      std::data( ts ), std::size( ts ), ymd, hms ) ) {
+						return civil_to_time_point( ymd.year, ymd.month, ymd.day, hms.hour,
+						                            hms.minute, hms.second,
+						                            hms.millisecond );
+					}
+				}
 				constexpr daw::string_view t_str = "T";
 				auto const date_str = ts.pop_front_until( t_str );
 				if( ts.empty( ) ) {
@@ -279,15 +408,10 @@ namespace daw::json {
 				std::uint_least32_t millisecond;
 			};
 
-			template<typename Clock, typename Duration>
-			constexpr ymdhms time_point_to_civil(
-			  std::chrono::time_point<Clock, Duration> const &tp ) {
-				auto dur_from_epoch = tp.time_since_epoch( );
-				using Days =
-				  std::chrono::duration<std::int_least32_t, std::ratio<86400>>;
-				auto const days_since_epoch =
-				  std::chrono::duration_cast<Days>( dur_from_epoch );
-				std::int_least32_t z = days_since_epoch.count( );
+			/***
+			 * Convert a count of days since 1970-01-01 to the civil date
+			 */
+			constexpr date_parts civil_from_days( std::int_least32_t z ) {
 				z += 719468;
 				std::int_least32_t const era = ( z >= 0 ? z : z - 146096 ) / 146097;
 				auto const doe =
@@ -303,6 +427,18 @@ namespace daw::json {
 				auto const m = static_cast<std::uint_least32_t>(
 				  static_cast<std::int_least32_t>( mp ) +
 				  ( static_cast<std::int_least32_t>( mp ) < 10 ? 3 : -9 ) ); // [1, 12]
+				return date_parts{ y + ( m <= 2 ), m, d };
+			}
+
+			template<typename Clock, typename Duration>
+			constexpr ymdhms time_point_to_civil(
+			  std::chrono::time_point<Clock, Duration> const &tp ) {
+				auto dur_from_epoch = tp.time_since_epoch( );
+				using Days =
+				  std::chrono::duration<std::int_least32_t, std::ratio<86400>>;
+				auto const days_since_epoch =
+				  std::chrono::duration_cast<Days>( dur_from_epoch );
+				date_parts const ymd = civil_from_days( days_since_epoch.count( ) );
 
 				dur_from_epoch -= days_since_epoch;
 				auto const hrs =
@@ -316,9 +452,9 @@ namespace daw::json {
 				dur_from_epoch -= sec;
 				auto const ms = std::chrono::duration_cast<std::chrono::milliseconds>(
 				  dur_from_epoch );
-				return ymdhms{ y + ( m <= 2 ),
-				               m,
-				               d,
+				return ymdhms{ ymd.year,
+				               ymd.month,
+				               ymd.day,
 				               static_cast<std::uint_least32_t>( hrs.count( ) ),
 				               static_cast<std::uint_least32_t>( min.count( ) ),
 				               static_cast<std::uint_least32_t>( sec.count( ) ),
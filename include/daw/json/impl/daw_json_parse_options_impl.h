@@ -157,6 +157,24 @@ namespace daw::json {
 			  default_json_option_value<options::ExcludeSpecialEscapes> =
 			    options::ExcludeSpecialEscapes::no;
 
+			template<>
+			inline constexpr unsigned
+			  json_option_bits_width<options::PrecountArrays> = 1;
+
+			template<>
+			inline constexpr auto
+			  default_json_option_value<options::PrecountArrays> =
+			    options::PrecountArrays::no;
+
+			template<>
+			inline constexpr unsigned
+			  json_option_bits_width<options::UnescapeInPlace> = 1;
+
+			template<>
+			inline constexpr auto
+			  default_json_option_value<options::UnescapeInPlace> =
+			    options::UnescapeInPlace::no;
+
 			using policy_list = typename option_list_impl<
 			  options::ExecModeTypes, options::ZeroTerminatedString,
 			  options::PolicyCommentTypes, options::CheckedParseMode,
@@ -164,7 +182,8 @@ namespace daw::json {
 			  options::ForceFullNameCheck, options::MinifiedDocument,
 			  options::UseExactMappingsByDefault, options::TemporarilyMutateBuffer,
 			  options::MustVerifyEndOfDataIsValid, options::ExcludeSpecialEscapes,
-			  options::ExpectLongNames>::type;
+			  options::ExpectLongNames, options::PrecountArrays,
+			  options::UnescapeInPlace>::type;
 
 			template<typename Policy, typename Policies>
 			inline constexpr unsigned basic_policy_bits_start =
@@ -64,8 +64,17 @@ namespace daw::json {
 				         PolicyFlags ) == options::TemporarilyMutateBuffer::yes;
 			}
 
-			using CharT = std::conditional_t<allow_temporarily_mutating_buffer( ),
-			                                 char, char const>;
+			/***
+			 * See options::UnescapeInPlace
+			 */
+			static constexpr bool unescape_in_place =
+			  json_details::get_bits_for<options::UnescapeInPlace>( PolicyFlags ) ==
+			  options::UnescapeInPlace::yes;
+
+			using CharT =
+			  std::conditional_t<allow_temporarily_mutating_buffer( ) or
+			                       unescape_in_place,
+			                     char, char const>;
 			using iterator = CharT *;
 
 			/***
@@ -150,6 +159,13 @@ namespace daw::json {
 			  json_details::get_bits_for<options::ExpectLongNames>( PolicyFlags ) ==
 			  options::ExpectLongNames::yes;
 
+			/***
+			 * See options::PrecountArrays
+			 */
+			static constexpr bool precount_arrays =
+			  json_details::get_bits_for<options::PrecountArrays>( PolicyFlags ) ==
+			  options::PrecountArrays::yes;
+
 			using CommentPolicy =
 			  switch_t<json_details::get_bits_for<options::PolicyCommentTypes,
 			                                      std::size_t>( PolicyFlags ),
@@ -193,6 +193,20 @@ namespace daw::json {
 							daw_json_ensure( ( *ptr_first != '\0' ) & ( *ptr_first == '"' ),
 							                 ErrorReason::UnexpectedEndOfData, parse_state );
 							break;
+						case '0':
+						case '1':
+						case '2':
+						case '3':
+						case '4':
+						case '5':
+						case '6':
+						case '7':
+						case '8':
+						case '9':
+							// Numeric arrays are mostly digits, skip the whole run at once
+							ptr_first = json_details::mem_skip_digits( ParseState::exec_tag,
+							                                           ptr_first, ptr_last );
+							continue;
 						case ',':
 							if( DAW_UNLIKELY( ( prime_bracket_count == 1 ) &
 							                  ( second_bracket_count == 0 ) ) ) {
@@ -254,6 +268,20 @@ namespace daw::json {
 							daw_json_ensure( ptr_first < ptr_last and *ptr_first == '"',
 							                 ErrorReason::UnexpectedEndOfData, parse_state );
 							break;
+						case '0':
+						case '1':
+						case '2':
+						case '3':
+						case '4':
+						case '5':
+						case '6':
+						case '7':
+						case '8':
+						case '9':
+							// Numeric arrays are mostly digits, skip the whole run at once
+							ptr_first = json_details::mem_skip_digits( ParseState::exec_tag,
+							                                           ptr_first, ptr_last );
+							continue;
 						case ',':
 							if( DAW_UNLIKELY( ( prime_bracket_count == 1 ) &
 							                  ( second_bracket_count == 0 ) ) ) {
@@ -332,6 +360,20 @@ namespace daw::json {
 							}
 						}
 						break;
+					case '0':
+					case '1':
+					case '2':
+					case '3':
+					case '4':
+					case '5':
+					case '6':
+					case '7':
+					case '8':
+					case '9':
+						// Numeric arrays are mostly digits, skip the whole run at once
+						ptr_first = json_details::mem_skip_digits(
+						  ParseState::exec_tag, ptr_first, parse_state.last );
+						continue;
 					case ',':
 						if( DAW_UNLIKELY( ( prime_bracket_count == 1 ) &
 						                  ( second_bracket_count == 0 ) ) ) {
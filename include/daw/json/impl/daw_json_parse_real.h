@@ -96,8 +96,8 @@ namespace daw::json {
 			template<typename ParseState, typename Result,
 			         typename max_storage_digits, typename CharT>
 			[[nodiscard]] inline constexpr bool
-			should_use_strtod( CharT *whole_first, CharT *whole_last,
-			                   CharT *fract_first, CharT *fract_last ) {
+			has_truncated_digits( CharT *whole_first, CharT *whole_last,
+			                      CharT *fract_first, CharT *fract_last ) {
 				if constexpr( std::is_floating_point_v<Result> and
 				              ParseState::precise_ieee754( ) ) {
 					return DAW_UNLIKELY(
@@ -114,6 +114,81 @@ namespace daw::json {
 				}
 			}
 
+			/// @brief Can the significant digits and exponent not be converted
+			/// exactly with a single floating point operation
+			template<typename Result, typename Unsigned, typename Signed>
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr bool
+			use_exact_real( bool is_truncated, Signed exponent,
+			                Unsigned significant_digits ) {
+				if constexpr( has_binary_format_v<Result> ) {
+					return is_truncated or
+					       not is_fast_path_real<Result>( exponent, significant_digits );
+				} else {
+					return is_truncated or exponent > 22 or exponent < -22 or
+					       significant_digits > 9007199254740992ULL;
+				}
+			}
+
+			/// @brief Convert exactly with Eisel-Lemire for float and double.  Other
+			/// floating point types use parse_with_strtod
+			template<typename Result, typename ExecTag, typename Unsigned,
+			         typename Signed, typename CharT>
+			[[nodiscard]] constexpr Result
+			parse_exact_real( ExecTag exec_tag, bool negative,
+			                  Unsigned significant_digits, Signed exponent,
+			                  bool is_truncated, CharT *first, CharT *last ) {
+				if constexpr( has_binary_format_v<Result> ) {
+					return parse_real_slow<Result>(
+					  exec_tag, negative,
+					  static_cast<std::uint64_t>( significant_digits ),
+					  static_cast<std::int64_t>( exponent ), is_truncated, first, last );
+				} else {
+					(void)exec_tag;
+					(void)negative;
+					(void)significant_digits;
+					(void)exponent;
+					(void)is_truncated;
+					using json_details::parse_with_strtod;
+					return parse_with_strtod<Result>( first, last );
+				}
+			}
+
+			/***
+			 * Finish parsing a float.  It is scaled in double and rounded to float
+			 * once.  With IEEE754Precise, w * 10^q in double is correctly rounded
+			 * when w < 2^53 and |q| <= 22, and so is the float unless the double
+			 * landed exactly half way between two floats.  Those and the values
+			 * outside of that range use parse_exact_real
+			 */
+			template<typename ParseState, typename Unsigned, typename Signed,
+			         typename CharT>
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr float
+			parse_float_result( bool negative, Unsigned significant_digits,
+			                    Signed exponent, bool is_truncated, CharT *first,
+			                    CharT *last ) {
+				if constexpr( ParseState::precise_ieee754( ) ) {
+					if( DAW_LIKELY( not is_truncated and exponent >= -22 and
+					                exponent <= 22 and
+					                significant_digits <= 9007199254740992ULL ) ) {
+						double const d =
+						  float_power10_in_double( significant_digits, exponent );
+						if( DAW_LIKELY( not is_float_midpoint( d ) ) ) {
+							auto const result = static_cast<float>( d );
+							return negative ? -result : result;
+						}
+					}
+					return parse_exact_real<float>( ParseState::exec_tag, negative,
+					                                significant_digits, exponent,
+					                                is_truncated, first, last );
+				} else {
+					(void)is_truncated;
+					(void)first;
+					(void)last;
+					float const result = power10_float( significant_digits, exponent );
+					return negative ? -result : result;
+				}
+			}
+
 			template<typename Result, typename ParseState>
 			[[nodiscard]] DAW_ATTRIB_INLINE static constexpr Result
 			parse_real_known( ParseState &parse_state ) {
@@ -147,8 +222,8 @@ namespace daw::json {
 				using max_storage_digits = daw::constant<static_cast<std::ptrdiff_t>(
 				  daw::numeric_limits<std::uint64_t>::digits10 )>;
 
-				bool use_strtod =
-				  should_use_strtod<ParseState, Result, max_storage_digits>(
+				bool is_truncated =
+				  has_truncated_digits<ParseState, Result, max_storage_digits>(
 				    whole_first, whole_last, fract_first, fract_last );
 
 				Result const sign = [&] {
@@ -174,6 +249,9 @@ namespace daw::json {
 				signed_t exponent = 0;
 
 				if( whole_exponent_available > max_exponent::value ) {
+					if constexpr( ParseState::precise_ieee754( ) ) {
+						is_truncated = true;
+					}
 					whole_last = whole_first + max_exponent::value;
 					whole_exponent_available -= max_exponent::value;
 					fract_exponent_available = 0;
@@ -183,8 +261,8 @@ namespace daw::json {
 					whole_exponent_available =
 					  max_exponent::value - whole_exponent_available;
 					if constexpr( ParseState::precise_ieee754( ) ) {
-						use_strtod |= DAW_UNLIKELY( fract_exponent_available >
-						                            whole_exponent_available );
+						is_truncated |= DAW_UNLIKELY( fract_exponent_available >
+						                              whole_exponent_available );
 					}
 					fract_exponent_available =
 					  ( std::min )( fract_exponent_available, whole_exponent_available );
@@ -251,22 +329,27 @@ namespace daw::json {
 					  }( ),
 					  exp_sign );
 				}
-				if constexpr( std::is_floating_point_v<Result> and
-				              ParseState::precise_ieee754( ) ) {
-					// On std floating point types, check for conditions that cannot be
-					// precisely calculated using the normal method and use the fallback
-					// method(usually strtod/from_chars)
-					use_strtod |= exponent > 22;
-					use_strtod |= exponent < -22;
-					use_strtod |= significant_digits > 9007199254740992ULL;
-					if( DAW_UNLIKELY( use_strtod ) ) {
-						return json_details::parse_with_strtod<Result>( parse_state.first,
-						                                                parse_state.last );
+				if constexpr( std::is_same_v<Result, float> ) {
+					return parse_float_result<ParseState>(
+					  sign < 0, significant_digits, exponent, is_truncated,
+					  parse_state.first, parse_state.last );
+				} else {
+					if constexpr( std::is_floating_point_v<Result> and
+					              ParseState::precise_ieee754( ) ) {
+						// On std floating point types, check for conditions that cannot
+						// be precisely calculated using the normal method and use the
+						// exact method
+						if( DAW_UNLIKELY( use_exact_real<Result>(
+						      is_truncated, exponent, significant_digits ) ) ) {
+							return parse_exact_real<Result>(
+							  ParseState::exec_tag, sign < 0, significant_digits, exponent,
+							  is_truncated, parse_state.first, parse_state.last );
+						}
 					}
+					return sign * power10<Result>(
+					                ParseState::exec_tag,
+					                static_cast<Result>( significant_digits ), exponent );
 				}
-				return sign * power10<Result>(
-				                ParseState::exec_tag,
-				                static_cast<Result>( significant_digits ), exponent );
 			}
 
 			template<typename Result, typename ParseState>
@@ -313,7 +396,7 @@ namespace daw::json {
 				  ParseState::is_unchecked_input )>( first, whole_last,
 				                                     significant_digits );
 				std::ptrdiff_t sig_digit_count = last_char - parse_state.first;
-				bool use_strtod =
+				bool is_truncated =
 				  std::is_floating_point_v<Result> and
 				  ParseState::precise_ieee754( ) and
 				  DAW_UNLIKELY( sig_digit_count > max_storage_digits::value );
@@ -321,14 +404,12 @@ namespace daw::json {
 					if( DAW_UNLIKELY( last_char >= whole_last ) ) {
 						if constexpr( std::is_floating_point_v<Result> and
 						              ParseState::precise_ieee754( ) ) {
-							use_strtod = true;
+							is_truncated = true;
 						}
 						// We have sig digits we cannot parse because there isn't enough
 						// room in a std::uint64_t
-						CharT *ptr =
-						  skip_digits<( ParseState::is_zero_terminated_string( ) or
-						                ParseState::is_unchecked_input )>(
-						    last_char, parse_state.last );
+						CharT *ptr = mem_skip_digits( ParseState::exec_tag, last_char,
+						                              parse_state.last );
 						auto const diff = ptr - last_char;
 
 						last_char = ptr;
@@ -348,9 +429,8 @@ namespace daw::json {
 					++first;
 					if( exponent_p1 != 0 ) {
 						if( first < parse_state.last ) {
-							first = skip_digits<( ParseState::is_zero_terminated_string( ) or
-							                      ParseState::is_unchecked_input )>(
-							  first, parse_state.last );
+							first = mem_skip_digits( ParseState::exec_tag, first,
+							                         parse_state.last );
 						}
 					} else {
 						CharT *fract_last =
@@ -367,13 +447,11 @@ namespace daw::json {
 						exponent_p1 -= static_cast<signed_t>( last_char - first );
 						first = last_char;
 						if( ( first >= fract_last ) & ( first < parse_state.last ) ) {
-							auto new_first =
-							  skip_digits<( ParseState::is_zero_terminated_string( ) or
-							                ParseState::is_unchecked_input )>(
-							    first, parse_state.last );
+							auto new_first = mem_skip_digits( ParseState::exec_tag, first,
+							                                  parse_state.last );
 							if constexpr( std::is_floating_point_v<Result> and
 							              ParseState::precise_ieee754( ) ) {
-								use_strtod |= new_first > first;
+								is_truncated |= new_first > first;
 							}
 							first = new_first;
 						}
@@ -454,20 +532,24 @@ namespace daw::json {
 				}( );
 				parse_state.first = first;
 
-				if constexpr( std::is_floating_point_v<Result> and
-				              ParseState::precise_ieee754( ) ) {
-					use_strtod |= DAW_UNLIKELY( exponent > 22 );
-					use_strtod |= DAW_UNLIKELY( exponent < -22 );
-					use_strtod |=
-					  DAW_UNLIKELY( significant_digits > 9007199254740992ULL );
-					if( DAW_UNLIKELY( use_strtod ) ) {
-						using json_details::parse_with_strtod;
-						return parse_with_strtod<Result>( orig_first, orig_last );
+				if constexpr( std::is_same_v<Result, float> ) {
+					return parse_float_result<ParseState>( sign < 0, significant_digits,
+					                                       exponent, is_truncated,
+					                                       orig_first, orig_last );
+				} else {
+					if constexpr( std::is_floating_point_v<Result> and
+					              ParseState::precise_ieee754( ) ) {
+						if( DAW_UNLIKELY( use_exact_real<Result>(
+						      is_truncated, exponent, significant_digits ) ) ) {
+							return parse_exact_real<Result>(
+							  ParseState::exec_tag, sign < 0, significant_digits, exponent,
+							  is_truncated, orig_first, orig_last );
+						}
 					}
+					return sign * power10<Result>(
+					                ParseState::exec_tag,
+					                static_cast<Result>( significant_digits ), exponent );
 				}
-				return sign * power10<Result>(
-				                ParseState::exec_tag,
-				                static_cast<Result>( significant_digits ), exponent );
 			}
 
 			template<typename Result, bool KnownRange, typename ParseState>
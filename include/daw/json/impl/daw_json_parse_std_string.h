@@ -16,6 +16,7 @@
 
 #include <daw/daw_likely.h>
 
+#include <algorithm>
 #include <ciso646>
 #include <string>
 #include <type_traits>
@@ -189,18 +190,16 @@ namespace daw::json {
 				inline constexpr char const escape_quotes[] = "\\\"";
 			}
 
-			// Fast path for parsing escaped strings to a std::string with the default
-			// appender
-			template<bool AllowHighEight, typename JsonMember, bool KnownBounds,
+			/***
+			 * Decode the escaped string in parse_state to it.  When InPlace is true,
+			 * it points into the string being decoded and is never after
+			 * parse_state.first, see options::UnescapeInPlace
+			 * @return The position after the last decoded character
+			 */
+			template<bool AllowHighEight, bool KnownBounds, bool InPlace,
 			         typename ParseState>
-			[[nodiscard]] static constexpr auto // json_result<JsonMember>
-			parse_string_known_stdstring( ParseState &parse_state ) {
-				using string_type = json_base_type<JsonMember>;
-				string_type result =
-				  string_type( std::size( parse_state ), '\0',
-				               parse_state.get_allocator_for( template_arg<char> ) );
-				char *it = std::data( result );
-
+			[[nodiscard]] static constexpr char *
+			unescape_string_to( ParseState &parse_state, char *it ) {
 				bool const has_quote = parse_state.front( ) == '"';
 				if( has_quote ) {
 					parse_state.remove_prefix( );
@@ -209,7 +208,11 @@ namespace daw::json {
 				if( auto const first_slash =
 				      static_cast<std::ptrdiff_t>( parse_state.counter ) - 1;
 				    first_slash > 1 ) {
-					it = std::copy_n( parse_state.first, first_slash, it );
+					if constexpr( InPlace ) {
+						it += first_slash;
+					} else {
+						it = std::copy_n( parse_state.first, first_slash, it );
+					}
 					parse_state.first += first_slash;
 				}
 				constexpr auto pred = []( auto const &r ) {
@@ -242,7 +245,17 @@ namespace daw::json {
 							    ParseState::is_zero_terminated_string( ) ),
 							  '"', '\\'>( ParseState::exec_tag, first, last );
 						}
-						it = daw::algorithm::copy( parse_state.first, first, it );
+						if constexpr( InPlace ) {
+							// it never passes parse_state.first, the decoded string is not
+							// longer than the escaped one
+							if( it != parse_state.first ) {
+								it = std::copy( parse_state.first, first, it );
+							} else {
+								it += first - parse_state.first;
+							}
+						} else {
+							it = daw::algorithm::copy( parse_state.first, first, it );
+						}
 						parse_state.first = first;
 					}
 					if( parse_state.front( ) == '\\' ) {
@@ -299,6 +312,23 @@ namespace daw::json {
 					daw_json_assert_weak( not has_quote or parse_state.has_more( ),
 					                      ErrorReason::UnexpectedEndOfData, parse_state );
 				}
+				return it;
+			}
+
+			// Fast path for parsing escaped strings to a std::string with the default
+			// appender
+			template<bool AllowHighEight, typename JsonMember, bool KnownBounds,
+			         typename ParseState>
+			[[nodiscard]] static constexpr auto // json_result<JsonMember>
+			parse_string_known_stdstring( ParseState &parse_state ) {
+				using string_type = json_base_type<JsonMember>;
+				string_type result =
+				  string_type( std::size( parse_state ), '\0',
+				               parse_state.get_allocator_for( template_arg<char> ) );
+				char *it = std::data( result );
+
+				it = unescape_string_to<AllowHighEight, KnownBounds, false>(
+				  parse_state, it );
 				auto const sz =
 				  static_cast<std::size_t>( std::distance( std::data( result ), it ) );
 				daw_json_assert_weak( std::size( result ) >= sz,
@@ -314,6 +344,26 @@ namespace daw::json {
 					  std::data( result ), daw::data_end( result ) );
 				}
 			}
+
+			/***
+			 * Decode the escaped string in parse_state inside the JSON buffer, see
+			 * options::UnescapeInPlace
+			 * @return The position after the last decoded character.  The decoded
+			 * string starts at the first character of the string
+			 */
+			template<bool AllowHighEight, bool KnownBounds, typename ParseState>
+			[[nodiscard]] static constexpr char *
+			parse_string_in_place( ParseState &parse_state ) {
+				static_assert(
+				  not std::is_const_v<typename ParseState::CharT>,
+				  "Unescaping in place requires a mutable buffer" );
+				char *it = parse_state.first;
+				if( parse_state.front( ) == '"' ) {
+					++it;
+				}
+				return unescape_string_to<AllowHighEight, KnownBounds, true>(
+				  parse_state, it );
+			}
 		} // namespace json_details
 	}   // namespace DAW_JSON_VER
 } // namespace daw::json
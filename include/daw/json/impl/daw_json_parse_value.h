@@ -11,6 +11,7 @@
 #include "version.h"
 
 #include "daw_json_assert.h"
+#include "daw_json_default_constuctor.h"
 #include "daw_json_parse_array_iterator.h"
 #include "daw_json_parse_kv_array_iterator.h"
 #include "daw_json_parse_kv_class_iterator.h"
@@ -29,11 +30,14 @@
 #include <daw/daw_traits.h>
 #include <daw/daw_utility.h>
 
+#include <algorithm>
 #include <ciso646>
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
 #include <tuple>
+#include <type_traits>
+#include <vector>
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
@@ -478,6 +482,16 @@ namespace daw::json {
 			inline constexpr bool has_json_member_parse_to_v =
 			  daw::is_detected_v<json_member_constructor_t, T>;
 
+			/***
+			 * The member type used to decode the escaped strings of a
+			 * basic_borrowed_string or interned_string into its string_type
+			 */
+			template<typename String>
+			struct decoded_string_member {
+				using parse_to_t = String;
+				using base_type = String;
+			};
+
 			template<typename JsonMember, bool KnownBounds = false,
 			         typename ParseState>
 			[[nodiscard]] DAW_ATTRIB_INLINE static constexpr json_result<JsonMember>
@@ -486,7 +500,60 @@ namespace daw::json {
 				static_assert( has_json_member_parse_to_v<JsonMember> );
 
 				using constructor_t = typename JsonMember::constructor_t;
-				if constexpr( can_parse_to_stdstring_fast_v<JsonMember> ) {
+				if constexpr( ParseState::unescape_in_place ) {
+					using AllowHighEightbits =
+					  std::bool_constant<JsonMember::eight_bit_mode !=
+					                     options::EightBitModes::DisallowHigh>;
+					auto parse_state2 =
+					  KnownBounds ? parse_state : skip_string( parse_state );
+					char const *first = std::data( parse_state2 );
+					char const *last = daw::data_end( parse_state2 );
+					if( not AllowHighEightbits::value or
+					    needs_slow_path( parse_state2 ) ) {
+						// Decode into the buffer, the string is never longer than the
+						// escaped one
+						if( first < last and *first == '"' ) {
+							++first;
+						}
+						last = parse_string_in_place<AllowHighEightbits::value, true>(
+						  parse_state2 );
+					}
+					if constexpr( std::is_invocable_v<constructor_t, char const *,
+					                                  std::size_t> ) {
+						return construct_value(
+						  template_args<json_result<JsonMember>, constructor_t>,
+						  parse_state, first, static_cast<std::size_t>( last - first ) );
+					} else {
+						return construct_value(
+						  template_args<json_result<JsonMember>, constructor_t>,
+						  parse_state, first, last );
+					}
+				} else if constexpr( is_borrowed_string_v<
+				                       json_base_type<JsonMember>> or
+				                     is_interned_string_v<
+				                       json_base_type<JsonMember>> ) {
+					using AllowHighEightbits =
+					  std::bool_constant<JsonMember::eight_bit_mode !=
+					                     options::EightBitModes::DisallowHigh>;
+					auto parse_state2 =
+					  KnownBounds ? parse_state : skip_string( parse_state );
+					if( not AllowHighEightbits::value or
+					    needs_slow_path( parse_state2 ) ) {
+						// Only strings with escapes are decoded before being stored
+						using string_type =
+						  typename json_base_type<JsonMember>::string_type;
+						return construct_value(
+						  template_args<json_result<JsonMember>, constructor_t>,
+						  parse_state,
+						  parse_string_known_stdstring<AllowHighEightbits::value,
+						                               decoded_string_member<string_type>,
+						                               true>( parse_state2 ) );
+					}
+					// Construct from the document text directly
+					return construct_value(
+					  template_args<json_result<JsonMember>, constructor_t>, parse_state,
+					  std::data( parse_state2 ), daw::data_end( parse_state2 ) );
+				} else if constexpr( can_parse_to_stdstring_fast_v<JsonMember> ) {
 					using AllowHighEightbits =
 					  std::bool_constant<JsonMember::eight_bit_mode !=
 					                     options::EightBitModes::DisallowHigh>;
@@ -614,6 +681,39 @@ namespace daw::json {
 				}
 			}
 
+			/***
+			 * Count the top level commas of the array or class that parse_state
+			 * starts at.  When the bounds are known, the value was already skipped
+			 * and counted when it was found.  See options::PrecountArrays
+			 */
+			template<bool KnownBounds, typename ParseState>
+			[[nodiscard]] static constexpr std::size_t
+			count_top_level_commas( ParseState const &parse_state ) {
+				if constexpr( KnownBounds ) {
+					return parse_state.counter;
+				} else {
+					auto tmp = parse_state;
+					if( tmp.front( ) == '[' ) {
+						return tmp.skip_array( ).counter;
+					}
+					return tmp.skip_class( ).counter;
+				}
+			}
+
+			/***
+			 * The number of elements from the count of commas.  parse_state must be
+			 * past the opening bracket
+			 */
+			template<char CloseBracket, typename ParseState>
+			[[nodiscard]] static constexpr std::size_t
+			size_hint_from_commas( ParseState parse_state, std::size_t comma_count ) {
+				parse_state.trim_left( );
+				if( parse_state.has_more( ) and parse_state.front( ) != CloseBracket ) {
+					return comma_count + 1U;
+				}
+				return 0U;
+			}
+
 			/**
 			 * Parse a key_value pair encoded as a json object where the keys are
 			 * the member names
@@ -633,17 +733,30 @@ namespace daw::json {
 				                      ErrorReason::ExpectedKeyValueToStartWithBrace,
 				                      parse_state );
 
-				parse_state.remove_prefix( );
-				parse_state.trim_left( );
-
 				using iter_t =
 				  json_parse_kv_class_iterator<JsonMember, ParseState,
 				                               can_be_random_iterator_v<KnownBounds>>;
-
 				using constructor_t = typename JsonMember::constructor_t;
-				return construct_value(
-				  template_args<json_result<JsonMember>, constructor_t>, parse_state,
-				  iter_t( parse_state ), iter_t( ) );
+
+				if constexpr( ParseState::precount_arrays and
+				              std::is_invocable_v<constructor_t, iter_t, iter_t,
+				                                  std::size_t> ) {
+					std::size_t const comma_count =
+					  count_top_level_commas<KnownBounds>( parse_state );
+					parse_state.remove_prefix( );
+					parse_state.trim_left( );
+					std::size_t const size_hint =
+					  size_hint_from_commas<'}'>( parse_state, comma_count );
+					return construct_value(
+					  template_args<json_result<JsonMember>, constructor_t>, parse_state,
+					  iter_t( parse_state ), iter_t( ), size_hint );
+				} else {
+					parse_state.remove_prefix( );
+					parse_state.trim_left( );
+					return construct_value(
+					  template_args<json_result<JsonMember>, constructor_t>, parse_state,
+					  iter_t( parse_state ), iter_t( ) );
+				}
 			}
 
 			/**
@@ -666,15 +779,162 @@ namespace daw::json {
 				  parse_state.is_opening_bracket_checked( ),
 				  ErrorReason::ExpectedKeyValueArrayToStartWithBracket, parse_state );
 
-				parse_state.remove_prefix( );
-
 				using iter_t =
 				  json_parse_kv_array_iterator<JsonMember, ParseState,
 				                               can_be_random_iterator_v<KnownBounds>>;
 				using constructor_t = typename JsonMember::constructor_t;
-				return construct_value(
-				  template_args<json_result<JsonMember>, constructor_t>, parse_state,
-				  iter_t( parse_state ), iter_t( ) );
+
+				if constexpr( ParseState::precount_arrays and
+				              std::is_invocable_v<constructor_t, iter_t, iter_t,
+				                                  std::size_t> ) {
+					std::size_t const comma_count =
+					  count_top_level_commas<KnownBounds>( parse_state );
+					parse_state.remove_prefix( );
+					std::size_t const size_hint =
+					  size_hint_from_commas<']'>( parse_state, comma_count );
+					return construct_value(
+					  template_args<json_result<JsonMember>, constructor_t>, parse_state,
+					  iter_t( parse_state ), iter_t( ), size_hint );
+				} else {
+					parse_state.remove_prefix( );
+					return construct_value(
+					  template_args<json_result<JsonMember>, constructor_t>, parse_state,
+					  iter_t( parse_state ), iter_t( ) );
+				}
+			}
+
+			/// @brief The bytes of x that are zero have their high bit set in the
+			/// result, all other bits are clear
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr std::uint64_t
+			swar_zero_bytes( std::uint64_t x ) {
+				constexpr std::uint64_t low_bits = 0x7F7F'7F7F'7F7F'7F7FULL;
+				return ~( ( ( x & low_bits ) + low_bits ) | x | low_bits );
+			}
+
+			/// @brief The number of bytes with their high bit set in a mask from
+			/// swar_zero_bytes
+			[[nodiscard]] DAW_ATTRIB_INLINE constexpr std::size_t
+			swar_count_bytes( std::uint64_t mask ) {
+				return static_cast<std::size_t>(
+				  ( ( mask >> 7U ) * 0x0101'0101'0101'0101ULL ) >> 56U );
+			}
+
+			/***
+			 * Count the commas before the first ']' in [first, last), 8 characters
+			 * at a time.  For an array of numbers this is the number of elements
+			 * less one, for anything else it is only a hint
+			 */
+			template<typename CharT>
+			[[nodiscard]] static constexpr std::size_t
+			count_number_array_commas( CharT *first, CharT *const last ) {
+				std::size_t count = 0;
+				while( last - first >= 8 ) {
+					std::uint64_t val = 0;
+					for( std::size_t n = 0; n < 8; ++n ) {
+						val |= static_cast<std::uint64_t>(
+						         static_cast<unsigned char>( first[n] ) )
+						       << ( 8U * n );
+					}
+					auto const commas = swar_zero_bytes( val ^ 0x2C2C'2C2C'2C2C'2C2CULL );
+					auto const closing =
+					  swar_zero_bytes( val ^ 0x5D5D'5D5D'5D5D'5D5DULL );
+					if( closing != 0 ) {
+						// Only the commas in the bytes before the first ']'
+						auto const before = ( closing & ( 0ULL - closing ) ) - 1U;
+						return count + swar_count_bytes( commas & before );
+					}
+					count += swar_count_bytes( commas );
+					first += 8;
+				}
+				while( first < last and *first != ']' ) {
+					count += static_cast<std::size_t>( *first == ',' );
+					++first;
+				}
+				return count;
+			}
+
+			template<typename>
+			inline constexpr bool is_std_vector_v = false;
+
+			template<typename T, typename Alloc>
+			inline constexpr bool is_std_vector_v<std::vector<T, Alloc>> = true;
+
+			/// @brief Is the array member a std::vector of numbers that is built
+			/// with the default constructor, see parse_value_number_array
+			template<typename JsonMember, typename ParseState>
+			[[nodiscard]] constexpr bool is_number_vector_array( ) {
+				using element_t = typename JsonMember::json_element_t;
+				using result_t = json_result<JsonMember>;
+				if constexpr( ParseState::has_allocator or
+				              not is_std_vector_v<result_t> ) {
+					return false;
+				} else {
+					constexpr JsonParseTypes element_type = element_t::expected_type;
+					return ( element_type == JsonParseTypes::Real or
+					         element_type == JsonParseTypes::Signed or
+					         element_type == JsonParseTypes::Unsigned ) and
+					       std::is_same_v<typename result_t::value_type,
+					                      json_result<element_t>> and
+					       is_std_allocator_v<typename result_t::allocator_type> and
+					       std::is_same_v<typename JsonMember::constructor_t,
+					                      default_constructor<result_t>>;
+				}
+			}
+
+			/***
+			 * Parse the elements of an array of numbers, passing each value to
+			 * out.  parse_state must be past the opening bracket.  The separators
+			 * are checked here instead of through json_parse_array_iterator, and
+			 * the closing bracket is handled as the iterator would
+			 */
+			template<typename JsonElement, bool KnownBounds, typename ParseState,
+			         typename Output>
+			DAW_ATTRIB_INLINE static constexpr void
+			parse_number_array_elements( ParseState &parse_state, Output out ) {
+				daw_json_assert_weak( parse_state.has_more( ),
+				                      ErrorReason::UnexpectedEndOfData, parse_state );
+				while( parse_state.front( ) != ']' ) {
+					out( parse_value<JsonElement>(
+					  parse_state, ParseTag<JsonElement::expected_type>{ } ) );
+					parse_state.trim_left( );
+					daw_json_assert_weak( parse_state.has_more( ) and
+					                        parse_state.is_at_next_array_element( ),
+					                      ErrorReason::UnexpectedEndOfData,
+					                      parse_state );
+					parse_state.move_next_member_or_end( );
+					daw_json_assert_weak( parse_state.has_more( ),
+					                      ErrorReason::UnexpectedEndOfData,
+					                      parse_state );
+				}
+				if constexpr( not KnownBounds ) {
+					parse_state.remove_prefix( );
+					parse_state.trim_left_checked( );
+				}
+			}
+
+			/***
+			 * Parse an array of numbers into a std::vector.  The elements are
+			 * counted by the commas before the closing bracket first, so the
+			 * vector is allocated once and each value is appended in place
+			 */
+			template<typename JsonMember, bool KnownBounds, typename ParseState>
+			[[nodiscard]] static constexpr json_result<JsonMember>
+			parse_value_number_array( ParseState &parse_state ) {
+				using element_t = typename JsonMember::json_element_t;
+				std::size_t comma_count = 0;
+				if constexpr( KnownBounds ) {
+					comma_count = parse_state.counter;
+				} else {
+					comma_count =
+					  count_number_array_commas( parse_state.first, parse_state.last );
+				}
+				auto result = json_result<JsonMember>( );
+				result.reserve( comma_count + 1U );
+				parse_number_array_elements<element_t, KnownBounds>(
+				  parse_state, [&]( auto value ) {
+					  result.push_back( value );
+				  } );
+				return result;
 			}
 
 			template<typename JsonMember, bool KnownBounds = false,
@@ -684,18 +944,38 @@ namespace daw::json {
 				parse_state.trim_left( );
 				daw_json_assert_weak( parse_state.is_opening_bracket_checked( ),
 				                      ErrorReason::InvalidArrayStart, parse_state );
-				parse_state.remove_prefix( );
-				parse_state.trim_left_unchecked( );
-				// TODO: add parse option to disable random access iterators. This is
-				// coding to the implementations
-
 				using iterator_t =
 				  json_parse_array_iterator<JsonMember, ParseState,
 				                            can_be_random_iterator_v<KnownBounds>>;
 				using constructor_t = typename JsonMember::constructor_t;
-				return construct_value(
-				  template_args<json_result<JsonMember>, constructor_t>, parse_state,
-				  iterator_t( parse_state ), iterator_t( ) );
+
+				if constexpr( is_number_vector_array<JsonMember,
+				                                     ParseState>( ) ) {
+					parse_state.remove_prefix( );
+					parse_state.trim_left_unchecked( );
+					return parse_value_number_array<JsonMember, KnownBounds>(
+					  parse_state );
+				} else if constexpr( ParseState::precount_arrays and
+				                     std::is_invocable_v<constructor_t, iterator_t,
+				                                         iterator_t, std::size_t> ) {
+					std::size_t const comma_count =
+					  count_top_level_commas<KnownBounds>( parse_state );
+					parse_state.remove_prefix( );
+					parse_state.trim_left_unchecked( );
+					std::size_t const size_hint =
+					  size_hint_from_commas<']'>( parse_state, comma_count );
+					return construct_value(
+					  template_args<json_result<JsonMember>, constructor_t>, parse_state,
+					  iterator_t( parse_state ), iterator_t( ), size_hint );
+				} else {
+					parse_state.remove_prefix( );
+					parse_state.trim_left_unchecked( );
+					// TODO: add parse option to disable random access iterators. This is
+					// coding to the implementations
+					return construct_value(
+					  template_args<json_result<JsonMember>, constructor_t>, parse_state,
+					  iterator_t( parse_state ), iterator_t( ) );
+				}
 			}
 
 			template<typename JsonMember, bool KnownBounds = false,
@@ -726,6 +1006,15 @@ namespace daw::json {
 				                      ErrorReason::InvalidArrayStart, parse_state );
 				parse_state.remove_prefix( );
 				parse_state.trim_left_unchecked( );
+				using size_type = daw::remove_cvref_t<decltype( sz )>;
+				if constexpr( std::is_signed_v<size_type> ) {
+					daw_json_ensure( sz >= 0, ErrorReason::NumberOutOfRange,
+					                 parse_state );
+				}
+				// The size is from the document and is only used to reserve.  Every
+				// element takes at least one character, limit it to what is left
+				auto const size_hint = ( std::min )( static_cast<std::size_t>( sz ),
+				                                     std::size( parse_state ) );
 				// TODO: add parse option to disable random access iterators. This is
 				// coding to the implementations
 				using iterator_t =
@@ -733,8 +1022,7 @@ namespace daw::json {
 				using constructor_t = typename JsonMember::constructor_t;
 				return construct_value(
 				  template_args<json_result<JsonMember>, constructor_t>, parse_state,
-				  iterator_t( parse_state ), iterator_t( ),
-				  static_cast<std::size_t>( sz ) );
+				  iterator_t( parse_state ), iterator_t( ), size_hint );
 			}
 
 			template<JsonBaseParseTypes BPT, typename JsonMembers, bool KnownBounds,
@@ -835,15 +1123,37 @@ namespace daw::json {
 				}
 			}
 
+			/***
+			 * A copy of parse_state that does not decode strings in place, for
+			 * parsing values that are parsed again later, see
+			 * options::UnescapeInPlace
+			 */
+			template<typename ParseState>
+			[[nodiscard]] static constexpr auto
+			without_unescape_in_place( ParseState const &parse_state ) {
+				if constexpr( ParseState::unescape_in_place ) {
+					using ParseState2 =
+					  apply_policy_option_t<ParseState, options::UnescapeInPlace::no>;
+					auto result = ParseState2::with_allocator(
+					  parse_state.first, parse_state.last, parse_state.class_first,
+					  parse_state.class_last, parse_state.get_allocator( ) );
+					result.counter = parse_state.counter;
+					return result;
+				} else {
+					return parse_state;
+				}
+			}
+
 			template<typename JsonMember, typename ParseState>
 			static constexpr auto find_index( ParseState parse_state ) {
 				using tag_member = typename JsonMember::tag_member;
 				using class_wrapper_t = typename JsonMember::tag_member_class_wrapper;
 
 				using switcher_t = typename JsonMember::switcher;
-				auto parse_state2 =
+				// The tag member is parsed again with the rest of the class
+				auto parse_state2 = without_unescape_in_place(
 				  ParseState( parse_state.class_first, parse_state.class_last,
-				              parse_state.class_first, parse_state.class_last );
+				              parse_state.class_first, parse_state.class_last ) );
 				if constexpr( is_an_ordered_member_v<tag_member> ) {
 					// This is an ordered class, class must start with '['
 					daw_json_assert_weak( parse_state2.is_opening_bracket_checked( ),
@@ -877,7 +1187,8 @@ namespace daw::json {
 					using tag_submember = typename JsonMember::tag_submember;
 					using class_wrapper_t =
 					  typename JsonMember::tag_submember_class_wrapper;
-					auto parse_state2 = parse_state;
+					// The tag submember is parsed again with the rest of the class
+					auto parse_state2 = without_unescape_in_place( parse_state );
 					using switcher_t = typename JsonMember::switcher;
 					if constexpr( is_an_ordered_member_v<tag_submember> ) {
 						return switcher_t{ }( std::get<0>( parse_value<class_wrapper_t>(
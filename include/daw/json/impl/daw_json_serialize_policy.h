@@ -58,6 +58,11 @@ namespace daw::json {
 
 			std::size_t indentation_level = 0;
 
+			/// Reused between consecutive json_date members in the same hour.  It
+			/// is owned by to_json so that copies of the policy share it, when
+			/// null every date is formatted in full
+			json_details::serialization::date_prefix_cache *date_cache = nullptr;
+
 			DAW_ATTRIB_INLINE constexpr WritableType const &get( ) const {
 				return *m_writable;
 			}
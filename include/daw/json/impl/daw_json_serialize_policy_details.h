@@ -15,7 +15,9 @@
 #include "daw_json_serialize_options_impl.h"
 
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <limits>
 
 namespace daw::json {
 	inline namespace DAW_JSON_VER {
@@ -247,6 +249,18 @@ namespace daw::json {
 				return static_cast<Result>( Policy{ value } );
 			}
 
+			/***
+			 * The "YYYY-MM-DDTHH" prefix of the last timestamp serialized.  Log
+			 * like output has many timestamps in the same hour, these only need
+			 * the minutes onward formatted.  Only 4 digit years are cached
+			 */
+			struct date_prefix_cache {
+				static constexpr std::size_t prefix_size = 13;
+				std::int_least64_t hours_since_epoch =
+				  ( std::numeric_limits<std::int_least64_t>::min )( );
+				char prefix[prefix_size]{ };
+			};
+
 			template<options::SerializationFormat, options::IndentationType>
 			inline constexpr std::string_view generate_indent{ };
 
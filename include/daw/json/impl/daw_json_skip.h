@@ -16,16 +16,13 @@
 #include "daw_json_parse_digit.h"
 #include "daw_json_parse_policy_policy_details.h"
 #include "daw_json_parse_string_quote.h"
+#include "daw_not_const_ex_functions.h"
 
 #include <daw/daw_attributes.h>
 #include <daw/daw_bit_cast.h>
 #include <daw/daw_likely.h>
 #include <daw/daw_unreachable.h>
 
-#if defined( DAW_CX_BIT_CAST )
-#include "daw_count_digits.h"
-#endif
-
 #include <ciso646>
 #include <iterator>
 
@@ -135,80 +132,12 @@ namespace daw::json {
 				return result;
 			}
 
-			template<bool skip_end_check, typename CharT>
-			DAW_ATTRIB_FLATINLINE [[nodiscard]] static inline constexpr CharT *
-			skip_digits( CharT *first, CharT *const last ) {
-				(void)last; // only used inside if constexpr and gcc9 warns
-				unsigned dig = parse_digit( *first );
-				while( dig < 10 ) {
-					++first;
-					if constexpr( not skip_end_check ) {
-						if( DAW_UNLIKELY( first >= last ) ) {
-							break;
-						}
-					}
-					dig = parse_digit( *first );
-				}
-				return first;
-			}
 			/***
 			 * Skip a number and store the position of it's components in the returned
-			 * ParseState
+			 * ParseState.  The runs of digits are skipped 8 characters at a time, or
+			 * 16 with the simd exec mode
 			 */
-
-			// DAW TODO: This branch has a bug that shows up in twitter_test2
-#if false and defined( DAW_CX_BIT_CAST )
-			template<typename ParseState,
-			         std::enable_if_t<( ParseState::is_unchecked_input or
-			                            ParseState::is_zero_terminated_string( ) ),
-			                          std::nullptr_t> = nullptr>
-			[[nodiscard]] static constexpr ParseState
-			skip_number( ParseState &parse_state ) {
-				using CharT = typename ParseState::CharT;
-
-				auto result = parse_state;
-				CharT *first = parse_state.first;
-				CharT *const last = parse_state.last;
-
-				if( *first == '-' ) {
-					++first;
-				}
-
-				first = count_digits( first, last );
-
-				CharT *decimal = nullptr;
-				if( *first == '.' ) {
-					decimal = first++;
-					first = count_digits( first, last );
-				}
-
-				CharT *exp = nullptr;
-				char const maybe_e = *first;
-				if( ( maybe_e == 'e' ) | ( maybe_e == 'E' ) ) {
-					exp = ++first;
-					char const maybe_sign = *first;
-					if( ( maybe_sign == '+' ) | ( maybe_sign == '-' ) ) {
-						++first;
-					}
-					first = count_digits( first, last );
-				}
-
-				daw_json_assert_weak( first <= last, ErrorReason::UnexpectedEndOfData );
-
-				parse_state.first = first;
-				result.last = first;
-				result.class_first = decimal;
-				result.class_last = exp;
-				return result;
-			}
-
-			template<typename ParseState,
-			         std::enable_if_t<not( ParseState::is_unchecked_input or
-			                               ParseState::is_zero_terminated_string( ) ),
-			                          std::nullptr_t> = nullptr>
-#else
 			template<typename ParseState>
-#endif
 			[[nodiscard]] static constexpr ParseState
 			skip_number( ParseState &parse_state ) {
 				using CharT = typename ParseState::CharT;
@@ -240,9 +169,7 @@ namespace daw::json {
 				}
 
 				if( DAW_LIKELY( first < last ) ) {
-					first =
-					  skip_digits<( ParseState::is_zero_terminated_string( ) or
-					                ParseState::is_unchecked_input )>( first, last );
+					first = mem_skip_digits( ParseState::exec_tag, first, last );
 				}
 
 				CharT *decimal = nullptr;
@@ -253,9 +180,7 @@ namespace daw::json {
 					decimal = first;
 					++first;
 					if( DAW_LIKELY( first < last ) ) {
-						first =
-						  skip_digits<( ParseState::is_zero_terminated_string( ) or
-						                ParseState::is_unchecked_input )>( first, last );
+						first = mem_skip_digits( ParseState::exec_tag, first, last );
 					}
 				}
 				CharT *exp = nullptr;
@@ -284,9 +209,7 @@ namespace daw::json {
 					                      ErrorReason::InvalidNumber );
 
 					if( DAW_LIKELY( first < last ) ) {
-						first =
-						  skip_digits<( ParseState::is_zero_terminated_string( ) or
-						                ParseState::is_unchecked_input )>( first, last );
+						first = mem_skip_digits( ParseState::exec_tag, first, last );
 					}
 				}
 
@@ -12,6 +12,7 @@
 
 #include "../concepts/daw_nullable_value.h"
 #include "../daw_json_data_contract.h"
+#include "../daw_json_parse_options.h"
 #include "daw_json_default_constuctor.h"
 #include "daw_json_enums.h"
 #include "daw_json_name.h"
@@ -26,6 +27,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 
@@ -288,6 +290,30 @@ namespace daw::json {
 			    (is_rvalue_string<String> and is_mutable_string_v<String>),
 			    apply_policy_option_t<ParsePolicy, OptionMutable>,
 			    apply_policy_option_t<ParsePolicy, OptionImmutable>>>;
+
+			/// @brief options::UnescapeInPlace writes to the buffer, it is turned
+			/// off when the buffer is not mutable
+			template<typename ParsePolicy, typename String>
+			using apply_unescape_in_place_policy_t = std::conditional_t<
+			  ( ParsePolicy::unescape_in_place and
+			    not is_mutable_string_v<String> ),
+			  apply_policy_option_t<ParsePolicy, options::UnescapeInPlace::no>,
+			  ParsePolicy>;
+
+			/// @brief Does the buffer own its characters, like std::string and
+			/// std::vector<char>.  Views like std::span<char> are trivially
+			/// copyable and owning containers are not
+			template<typename String>
+			inline constexpr bool is_owning_buffer_v =
+			  not std::is_trivially_copyable_v<daw::remove_cvref_t<String>>;
+
+			/// @brief The views into the buffer made by options::UnescapeInPlace
+			/// would dangle if the buffer is a temporary that owns its characters
+			template<typename ParsePolicy, typename String>
+			inline constexpr bool is_valid_unescape_in_place_buffer_v =
+			  not ParsePolicy::unescape_in_place or
+			  std::is_lvalue_reference_v<String> or
+			  not is_mutable_string_v<String> or not is_owning_buffer_v<String>;
 		} // namespace json_details
 
 		/***
@@ -10,6 +10,7 @@
 
 #include "version.h"
 
+#include "daw_count_digits.h"
 #include "daw_json_assert.h"
 #include "daw_json_exec_modes.h"
 
@@ -35,6 +36,7 @@
 
 #include <ciso646>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 
 namespace daw::json {
@@ -343,6 +345,32 @@ namespace daw::json {
 				                                                            : last;
 			}
 
+			/***
+			 * Skip a run of digits 16 characters at a time, the remainder is
+			 * finished 8 at a time by count_digits
+			 */
+			template<typename CharT>
+			DAW_ATTRIB_INLINE CharT *mem_skip_digits( sse42_exec_tag tag,
+			                                          CharT *first,
+			                                          CharT *const last ) {
+				__m128i const below_zero = _mm_set1_epi8( '0' - 1 );
+				__m128i const above_nine = _mm_set1_epi8( '9' + 1 );
+				while( last - first >= 16 ) {
+					auto const block = uload16_char_data( tag, first );
+					__m128i const digits =
+					  _mm_and_si128( _mm_cmpgt_epi8( block, below_zero ),
+					                 _mm_cmplt_epi8( block, above_nine ) );
+					auto const non_digits = to_uint32(
+					  ~static_cast<std::uint32_t>( _mm_movemask_epi8( digits ) ) &
+					  0xFFFFU );
+					if( non_digits != 0 ) {
+						return first + find_lsb_set( tag, non_digits );
+					}
+					first += 16;
+				}
+				return count_digits( first, last );
+			}
+
 #endif
 			template<bool is_unchecked_input, char... keys, typename CharT>
 			DAW_ATTRIB_INLINE CharT *
@@ -370,6 +398,16 @@ namespace daw::json {
 				}
 			}
 
+			/***
+			 * @return Pointer to the first character in [first, last) that is not
+			 * a digit, or last
+			 */
+			template<typename CharT>
+			DAW_ATTRIB_INLINE constexpr CharT *
+			mem_skip_digits( constexpr_exec_tag, CharT *first, CharT *const last ) {
+				return count_digits( first, last );
+			}
+
 			template<bool is_unchecked_input, typename CharT>
 			DAW_ATTRIB_INLINE CharT *mem_skip_string( runtime_exec_tag const &tag,
 			                                          CharT *first,
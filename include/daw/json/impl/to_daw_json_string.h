@@ -11,6 +11,7 @@
 #include "version.h"
 
 #include "../daw_json_data_contract.h"
+#include "daw_count_digits.h"
 #include "daw_json_assert.h"
 #include "daw_json_parse_iso8601_utils.h"
 #include "daw_json_serialize_options_impl.h"
@@ -29,8 +30,12 @@
 #include <daw/third_party/dragonbox/dragonbox.h>
 #include <daw/utf8/unchecked.h>
 
+#include <algorithm>
 #include <array>
+#include <chrono>
 #include <ciso646>
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <sstream>
 #include <string>
@@ -103,6 +108,30 @@ namespace daw::json {
 			inline constexpr bool has_istream_op_v =
 			  daw::is_detected_v<has_rshift_test, std::stringstream, T>;
 
+			/***
+			 * A ToJsonConverter that takes the output and the value and returns
+			 * the output, `WritableType operator( )( WritableType, T const & )`,
+			 * writes into the serializer directly instead of returning a string
+			 */
+			template<typename Converter, typename WritableType, typename T>
+			inline constexpr bool is_direct_to_converter_v =
+			  std::is_invocable_r_v<WritableType, Converter, WritableType,
+			                        T const &>;
+
+			/***
+			 * Types using the default ToJsonConverter can opt into writing
+			 * directly by providing
+			 * `WritableType to_json_output( WritableType it, T const &value )`,
+			 * found via ADL
+			 */
+			template<typename WritableType, typename T>
+			using to_json_output_test = decltype( to_json_output(
+			  std::declval<WritableType>( ), std::declval<T const &>( ) ) );
+
+			template<typename WritableType, typename T>
+			inline constexpr bool has_to_json_output_v =
+			  daw::is_detected_v<to_json_output_test, WritableType, T>;
+
 		} // namespace json_details
 
 		/***
@@ -647,20 +676,77 @@ namespace daw::json {
 				return result;
 			}( );
 
-			template<typename T>
-			static constexpr void reverse( T *first, T *last ) {
-				// Assume preconditions. This helps on CE in codegen but may
-				// not matter here with inlining
-				DAW_ASSUME( first and last );
-				DAW_ASSUME( first <= last );
-				auto rpos = last - first;
-				auto lpos = 0;
-				while( lpos < rpos ) {
-					--rpos;
-					auto tmp = DAW_MOVE( first[lpos] );
-					first[lpos] = DAW_MOVE( first[rpos] );
-					first[rpos] = DAW_MOVE( tmp );
-					++lpos;
+			template<typename Integer>
+			struct unsigned_magnitude {
+				using type = std::make_unsigned_t<Integer>;
+			};
+
+			template<>
+			struct unsigned_magnitude<bool> {
+				using type = unsigned;
+			};
+
+#if defined( DAW_HAS_INT128 )
+			template<>
+			struct unsigned_magnitude<__int128> {
+				using type = unsigned __int128;
+			};
+
+			template<>
+			struct unsigned_magnitude<unsigned __int128> {
+				using type = unsigned __int128;
+			};
+#endif
+
+			template<typename Integer>
+			using unsigned_magnitude_t = typename unsigned_magnitude<Integer>::type;
+
+			/***
+			 * Write exactly len digits of v to ptr.  The digits are written two at a
+			 * time from the end of the range so that no reverse pass is needed.
+			 * Leading positions are zero filled when v has fewer than len digits
+			 * @return ptr + len
+			 */
+			template<typename Unsigned>
+			DAW_ATTRIB_INLINE static constexpr char *
+			write_base10_digits_n( char *ptr, Unsigned v, std::size_t len ) {
+				char *const last = ptr + len;
+				char *pos = last;
+				while( pos - ptr >= 2 ) {
+					auto const tmp = static_cast<std::size_t>( v % 100U );
+					v /= 100U;
+					pos -= 2;
+					pos[0] = digits100[tmp][1];
+					pos[1] = digits100[tmp][0];
+				}
+				if( pos != ptr ) {
+					*ptr = static_cast<char>( '0' + static_cast<char>( v ) );
+				}
+				return last;
+			}
+
+			/***
+			 * Write the base 10 representation of v to ptr.  The digit count is
+			 * calculated first so that each digit lands in it's final position.
+			 * @pre ptr has room for count_base10_digits( v ) characters
+			 * @return pointer to one past the last digit written
+			 */
+			template<typename Unsigned>
+			static constexpr char *write_base10_digits( char *ptr, Unsigned v ) {
+				if constexpr( sizeof( Unsigned ) > sizeof( std::uint64_t ) ) {
+					// 128bit division is expensive, peel off 19 digit blocks and do the
+					// rest with 64bit math
+					if( v > daw::numeric_limits<std::uint64_t>::max( ) ) {
+						constexpr auto pow10_19 =
+						  static_cast<Unsigned>( 10'000'000'000'000'000'000ULL );
+						ptr = write_base10_digits(
+						  ptr, static_cast<Unsigned>( v / pow10_19 ) );
+						return write_base10_digits_n(
+						  ptr, static_cast<std::uint64_t>( v % pow10_19 ), 19 );
+					}
+					return write_base10_digits( ptr, static_cast<std::uint64_t>( v ) );
+				} else {
+					return write_base10_digits_n( ptr, v, count_base10_digits( v ) );
 				}
 			}
 
@@ -678,50 +764,24 @@ namespace daw::json {
 
 				if constexpr( std::disjunction_v<std::is_enum<parse_to_t>,
 				                                 daw::is_integral<parse_to_t>> ) {
-					auto v = static_cast<under_type>( value );
+					using magnitude_t = unsigned_magnitude_t<under_type>;
+					auto const v = static_cast<under_type>( value );
 
 					char buff[daw::numeric_limits<under_type>::digits10 + 10]{ };
-					char *num_start = buff;
 					char *ptr = buff;
 					if constexpr( JsonMember::literal_as_string ==
 					              options::LiteralAsStringOpt::Always ) {
 						*ptr++ = '"';
-						++num_start;
 					}
+					// Negating in the unsigned type is well defined for
+					// daw::numeric_limits<under_type>::min( )
+					auto magnitude = static_cast<magnitude_t>( v );
 					if( v < 0 ) {
 						*ptr++ = '-';
-						++num_start;
-						// Do 1 round here just in case we are
-						// daw::numeric_limits<intmax_t>::min( ) and cannot negate
-						// This is a subtraction because when v < 0, v % 100 is negative
-						auto const tmp = -static_cast<std::size_t>( v % 10 );
-						v /= -10;
-						*ptr++ = digits100[tmp][0];
-						if( v == 0 ) {
-							if constexpr( JsonMember::literal_as_string ==
-							              options::LiteralAsStringOpt::Always ) {
-								*ptr++ = '"';
-							}
-							it.copy_buffer( buff, ptr );
-							return it;
-						}
-					}
-
-					if( v == 0 ) {
-						*ptr++ = '0';
-					}
-					while( v >= 10 ) {
-						auto const tmp = static_cast<std::size_t>( v % 100 );
-						v /= 100;
-						ptr[0] = digits100[tmp][0];
-						ptr[1] = digits100[tmp][1];
-						ptr += 2;
+						magnitude =
+						  static_cast<magnitude_t>( magnitude_t{ 0 } - magnitude );
 					}
-					if( v > 0 ) {
-						*ptr++ = static_cast<char>( '0' + static_cast<char>( v ) );
-					}
-
-					reverse( num_start, ptr );
+					ptr = write_base10_digits( ptr, magnitude );
 					if constexpr( JsonMember::literal_as_string ==
 					              options::LiteralAsStringOpt::Always ) {
 						*ptr++ = '"';
@@ -767,25 +827,15 @@ namespace daw::json {
 				} else if constexpr( std::disjunction_v<
 				                       std::is_enum<parse_to_t>,
 				                       daw::is_integral<parse_to_t>> ) {
-					auto v = static_cast<under_type>( value );
+					auto const v = static_cast<under_type>( value );
 
 					if( DAW_UNLIKELY( v == 0 ) ) {
 						it.put( '0' );
 					} else {
 						daw_json_ensure( v > 0, ErrorReason::NumberOutOfRange );
 						char buff[daw::numeric_limits<under_type>::digits10 + 10]{ };
-						char *ptr = buff;
-						while( v >= 10 ) {
-							auto const tmp = v % 100U;
-							v /= 100U;
-							ptr[0] = digits100[tmp][0];
-							ptr[1] = digits100[tmp][1];
-							ptr += 2;
-						}
-						if( v > 0 ) {
-							*ptr++ = static_cast<char>( '0' + static_cast<char>( v ) );
-						}
-						reverse( buff, ptr );
+						char *const ptr = write_base10_digits(
+						  buff, static_cast<unsigned_magnitude_t<under_type>>( v ) );
 						it.copy_buffer( buff, ptr );
 					}
 				} else {
@@ -872,6 +922,39 @@ namespace daw::json {
 				return false;
 			}
 
+			/***
+			 * Write "YYYY-MM-DDTHH" for the hour that starts hours_since_epoch
+			 * hours after 1970-01-01T00Z.  Years are zero padded to 4 digits, wider
+			 * and negative years are written in full
+			 * @return pointer to one past the last character written
+			 */
+			static constexpr char *write_date_hour( char *ptr,
+			                                        std::int_least64_t hours ) {
+				std::int_least64_t days = hours / 24;
+				std::int_least64_t hour = hours % 24;
+				if( hour < 0 ) {
+					hour += 24;
+					--days;
+				}
+				auto const ymd = datetime::civil_from_days(
+				  static_cast<std::int_least32_t>( days ) );
+				if( ymd.year < 0 ) {
+					*ptr++ = '-';
+				}
+				auto const year = static_cast<std::uint_least32_t>(
+				  ymd.year < 0 ? -ymd.year : ymd.year );
+				auto const year_digits =
+				  ( std::max )( std::size_t{ 4 }, count_base10_digits( year ) );
+				ptr = write_base10_digits_n( ptr, year, year_digits );
+				*ptr++ = '-';
+				ptr = write_base10_digits_n( ptr, ymd.month, 2 );
+				*ptr++ = '-';
+				ptr = write_base10_digits_n( ptr, ymd.day, 2 );
+				*ptr++ = 'T';
+				return write_base10_digits_n(
+				  ptr, static_cast<std::uint_least32_t>( hour ), 2 );
+			}
+
 			template<typename JsonMember, typename WriteableType, typename parse_to_t>
 			[[nodiscard]] static constexpr WriteableType
 			to_json_string_date( WriteableType it, parse_to_t const &value ) {
@@ -886,39 +969,54 @@ namespace daw::json {
 					it.write( "null" );
 					return it;
 				}
-				it.put( '"' );
-				datetime::ymdhms const civil = datetime::time_point_to_civil( value );
-				it = utils::integer_to_string( it, civil.year );
-				it.put( '-' );
-				if( civil.month < 10 ) {
-					it.put( '0' );
-				}
-				it = utils::integer_to_string( it, civil.month );
-				it.put( '-' );
-				if( civil.day < 10 ) {
-					it.put( '0' );
-				}
-				it = utils::integer_to_string( it, civil.day );
-				it.put( 'T' );
-				if( civil.hour < 10 ) {
-					it.put( '0' );
-				}
-				it = utils::integer_to_string( it, civil.hour );
-				it.put( ':' );
-				if( civil.minute < 10 ) {
-					it.put( '0' );
-				}
-				it = utils::integer_to_string( it, civil.minute );
-				it.put( ':' );
-				if( civil.second < 10 ) {
-					it.put( '0' );
-				}
-				it = utils::integer_to_string( it, civil.second );
-				if( civil.millisecond > 0 ) {
-					it.put( '.' );
-					it = utils::integer_to_string( it, civil.millisecond );
-				}
-				it.write( "Z\"" );
+				auto const ms_since_epoch = static_cast<std::int_least64_t>(
+				  std::chrono::floor<std::chrono::milliseconds>( value )
+				    .time_since_epoch( )
+				    .count( ) );
+				constexpr std::int_least64_t ms_per_hour = 3'600'000;
+				std::int_least64_t hours = ms_since_epoch / ms_per_hour;
+				std::int_least64_t ms_of_hour = ms_since_epoch % ms_per_hour;
+				if( ms_of_hour < 0 ) {
+					ms_of_hour += ms_per_hour;
+					--hours;
+				}
+				// "YYYY-MM-DDTHH:MM:SS.sssZ" with the quotes and room for wide years
+				char buff[48]{ };
+				char *ptr = buff;
+				*ptr++ = '"';
+				auto *const cache = it.date_cache;
+				constexpr auto prefix_size = static_cast<std::ptrdiff_t>(
+				  serialization::date_prefix_cache::prefix_size );
+				if( DAW_LIKELY( cache != nullptr and
+				                hours == cache->hours_since_epoch ) ) {
+					for( std::ptrdiff_t n = 0; n < prefix_size; ++n ) {
+						ptr[n] = cache->prefix[n];
+					}
+					ptr += prefix_size;
+				} else {
+					char *const prefix = ptr;
+					ptr = write_date_hour( ptr, hours );
+					if( cache != nullptr and ptr - prefix == prefix_size ) {
+						for( std::ptrdiff_t n = 0; n < prefix_size; ++n ) {
+							cache->prefix[n] = prefix[n];
+						}
+						cache->hours_since_epoch = hours;
+					}
+				}
+				auto const ms_of_min = static_cast<std::uint_least32_t>(
+				  ms_of_hour % 60'000 );
+				*ptr++ = ':';
+				ptr = write_base10_digits_n(
+				  ptr, static_cast<std::uint_least32_t>( ms_of_hour / 60'000 ), 2 );
+				*ptr++ = ':';
+				ptr = write_base10_digits_n( ptr, ms_of_min / 1000U, 2 );
+				if( auto const ms = ms_of_min % 1000U; ms > 0 ) {
+					*ptr++ = '.';
+					ptr = write_base10_digits_n( ptr, ms, 3 );
+				}
+				*ptr++ = 'Z';
+				*ptr++ = '"';
+				it.copy_buffer( buff, ptr );
 				return it;
 			}
 
@@ -955,6 +1053,40 @@ namespace daw::json {
 				}
 			}
 
+			template<typename T>
+			inline constexpr bool is_default_to_json_converter_v = false;
+
+			template<typename T>
+			inline constexpr bool
+			  is_default_to_json_converter_v<default_to_json_converter_t<T>> = true;
+
+			/***
+			 * Write the value of a json_custom member without the surrounding
+			 * quotes.  Converters that write directly to the output are preferred,
+			 * then the to_json_output customization point and integers when using
+			 * the default converter.  Otherwise the string like result of the
+			 * converter is copied to the output
+			 */
+			template<typename JsonMember, typename WriteableType, typename parse_to_t>
+			[[nodiscard]] static constexpr WriteableType
+			to_json_custom_output( WriteableType it, parse_to_t const &value ) {
+				using to_converter_t = typename JsonMember::to_converter_t;
+				if constexpr( is_direct_to_converter_v<to_converter_t, WriteableType,
+				                                       parse_to_t> ) {
+					return to_converter_t{ }( it, value );
+				} else if constexpr( is_default_to_json_converter_v<to_converter_t> and
+				                     has_to_json_output_v<WriteableType,
+				                                          parse_to_t> ) {
+					return to_json_output( it, value );
+				} else if constexpr( is_default_to_json_converter_v<to_converter_t> and
+				                     daw::is_integral_v<parse_to_t> and
+				                     not std::is_same_v<parse_to_t, bool> ) {
+					return utils::integer_to_string( it, value );
+				} else {
+					return utils::copy_to_iterator( it, to_converter_t{ }( value ) );
+				}
+			}
+
 			template<typename JsonMember, typename WriteableType, typename parse_to_t>
 			[[nodiscard]] static inline constexpr WriteableType
 			to_json_string_custom( WriteableType it, parse_to_t const &value ) {
@@ -966,20 +1098,11 @@ namespace daw::json {
 				if constexpr( JsonMember::custom_json_type !=
 				              options::JsonCustomTypes::Literal ) {
 					it.put( '"' );
-					if constexpr( std::is_invocable_r_v<
-					                WriteableType, typename JsonMember::to_converter_t,
-					                WriteableType, parse_to_t> ) {
-
-						it = typename JsonMember::to_converter_t{ }( it, value );
-					} else {
-						it = utils::copy_to_iterator(
-						  it, typename JsonMember::to_converter_t{ }( value ) );
-					}
+					it = to_json_custom_output<JsonMember>( it, value );
 					it.put( '"' );
 					return it;
 				} else {
-					return utils::copy_to_iterator(
-					  it, typename JsonMember::to_converter_t{ }( value ) );
+					return to_json_custom_output<JsonMember>( it, value );
 				}
 			}
 
@@ -1123,6 +1246,41 @@ namespace daw::json {
 				  ParseTag<JsonParseTypes::Array>{ }, it, value );
 			}
 
+			/***
+			 * The "name": prefix of a class member, including the trailing space
+			 * when the output is not minified.  Member names are known at compile
+			 * time so the prefix is built once and written with a single call
+			 */
+			template<typename JsonMember, bool WithSpace>
+			inline constexpr auto json_member_name_prefix = [] {
+				constexpr auto name = daw::string_view( JsonMember::name );
+				std::array<char, name.size( ) + ( WithSpace ? 4U : 3U )> result{ };
+				std::size_t pos = 0;
+				result[pos++] = '"';
+				for( char c : name ) {
+					result[pos++] = c;
+				}
+				result[pos++] = '"';
+				result[pos++] = ':';
+				if constexpr( WithSpace ) {
+					result[pos++] = ' ';
+				}
+				return result;
+			}( );
+
+			template<typename JsonMember, typename WriteableType,
+			         json_options_t SerializationOptions>
+			DAW_ATTRIB_INLINE static constexpr void write_member_name(
+			  serialization_policy<WriteableType, SerializationOptions> &it ) {
+				constexpr bool with_space =
+				  serialization_policy<WriteableType,
+				                       SerializationOptions>::serialization_format !=
+				  options::SerializationFormat::Minified;
+				constexpr auto const &prefix =
+				  json_member_name_prefix<JsonMember, with_space>;
+				it.write( daw::string_view( prefix.data( ), prefix.size( ) ) );
+			}
+
 			template<typename Key, typename Value>
 			static inline constexpr Key const &
 			json_get_key( std::pair<Key, Value> const &kv ) {
@@ -1159,7 +1317,7 @@ namespace daw::json {
 					it.add_indent( );
 					it.next_member( );
 					// Append Key Name
-					it.write( "\"", key_t::name, "\":", it.space );
+					write_member_name<key_t>( it );
 					// Append Key Value
 					it = to_daw_json_string<key_t>( ParseTag<key_t::expected_type>{ }, it,
 					                                json_get_key( *first ) );
@@ -1167,7 +1325,7 @@ namespace daw::json {
 					it.put( ',' );
 					// Append Value Name
 					it.next_member( );
-					it.write( "\"", value_t::name, "\":", it.space );
+					write_member_name<value_t>( it );
 					// Append Value Value
 					it = to_daw_json_string<value_t>( ParseTag<value_t::expected_type>{ },
 					                                  it, json_get_value( *first ) );
@@ -1387,7 +1545,7 @@ namespace daw::json {
 					}
 					it.next_member( );
 					is_first = false;
-					it.write( '"', dependent_member::name, "\":", it.space );
+					write_member_name<dependent_member>( it );
 
 					if constexpr( has_switcher_v<base_member_t> ) {
 						it = member_to_string( template_arg<dependent_member>, it,
@@ -1428,7 +1586,7 @@ namespace daw::json {
 				}
 				it.next_member( );
 				is_first = false;
-				it.write( '"', JsonMember::name, "\":", it.space );
+				write_member_name<JsonMember>( it );
 
 				it = member_to_string( template_arg<JsonMember>, DAW_MOVE( it ),
 				                       get<pos>( tp ) );
@@ -1468,10 +1626,86 @@ namespace daw::json {
 				}
 			}
 
+			/// @brief Write count zeros to out_it in blocks
+			template<typename WriteableType>
+			static constexpr WriteableType write_zeros( WriteableType out_it,
+			                                            std::int32_t count ) {
+				constexpr char zeros[] = "0000000000000000";
+				constexpr std::int32_t block_size = sizeof( zeros ) - 1;
+				while( count > 0 ) {
+					auto const sz = ( std::min )( count, block_size );
+					out_it.copy_buffer( zeros, zeros + sz );
+					count -= sz;
+				}
+				return out_it;
+			}
+
+			/***
+			 * Write significand * 10^exponent, the shortest round trip digits from
+			 * dragonbox, in <whole>[.fraction] form.  The sign, digits, decimal
+			 * point and up to max_padding zeros are assembled in a buffer sized
+			 * for the significand of Real, 9 digits for float and 17 for double,
+			 * and written with one copy
+			 */
+			template<typename Real, typename WriteableType, typename Unsigned>
+			static constexpr WriteableType
+			write_fixed_real( WriteableType out_it, bool is_negative,
+			                  Unsigned significand, std::int32_t exponent,
+			                  std::int32_t digits ) {
+				constexpr std::int32_t max_padding = 16;
+				// sign, "0.", padding and digits
+				char buff[3 + max_padding + daw::numeric_limits<Real>::max_digits10]{ };
+				char *ptr = buff;
+				if( is_negative ) {
+					*ptr++ = '-';
+				}
+				std::int32_t const whole_digits = digits + exponent;
+				if( whole_digits <= 0 ) {
+					*ptr++ = '0';
+					*ptr++ = '.';
+					std::int32_t const zeros = -whole_digits;
+					if( DAW_UNLIKELY( zeros > max_padding ) ) {
+						out_it.copy_buffer( buff, ptr );
+						out_it = write_zeros( out_it, zeros );
+						ptr = buff;
+					} else {
+						for( std::int32_t n = 0; n < zeros; ++n ) {
+							*ptr++ = '0';
+						}
+					}
+					ptr = write_base10_digits_n( ptr, significand,
+					                             static_cast<std::size_t>( digits ) );
+				} else if( exponent >= 0 ) {
+					ptr = write_base10_digits_n( ptr, significand,
+					                             static_cast<std::size_t>( digits ) );
+					if( DAW_UNLIKELY( exponent > max_padding ) ) {
+						out_it.copy_buffer( buff, ptr );
+						return write_zeros( out_it, exponent );
+					}
+					for( std::int32_t n = 0; n < exponent; ++n ) {
+						*ptr++ = '0';
+					}
+				} else {
+					// Write the digits one place to the right, then move the whole
+					// digits back over the place of the decimal point
+					char *const first = ptr;
+					ptr = write_base10_digits_n( first + 1, significand,
+					                             static_cast<std::size_t>( digits ) );
+					for( std::int32_t n = 0; n < whole_digits; ++n ) {
+						first[n] = first[n + 1];
+					}
+					first[whole_digits] = '.';
+				}
+				out_it.copy_buffer( buff, ptr );
+				return out_it;
+			}
+
 			template<options::FPOutputFormat fp_output_fmt, typename WriteableType,
 			         typename Real>
 			static constexpr WriteableType to_chars( Real const &value,
 			                                         WriteableType out_it ) {
+				// float uses the float specialization of dragonbox, a 32bit
+				// significand of at most 9 digits
 				daw::jkj::dragonbox::unsigned_fp_t<Real> dec =
 				  daw::jkj::dragonbox::to_decimal(
 				    value, daw::jkj::dragonbox::policy::sign::ignore );
@@ -1480,7 +1714,8 @@ namespace daw::json {
 				  daw::jkj::dragonbox::to_chars_detail::decimal_length(
 				    dec.significand );
 
-				auto whole_dig = static_cast<std::int32_t>( digits ) + dec.exponent;
+				auto const whole_dig =
+				  static_cast<std::int32_t>( digits ) + dec.exponent;
 
 				auto const br = [&] {
 					if constexpr( std::is_same_v<Real, float> ) {
@@ -1497,59 +1732,23 @@ namespace daw::json {
 					out_it.put( '0' );
 					return out_it;
 				}
-				if( fp_output_fmt == options::FPOutputFormat::Scientific ) {
+				if( fp_output_fmt == options::FPOutputFormat::Scientific or
+				    ( fp_output_fmt == options::FPOutputFormat::Auto and
+				      ( ( whole_dig < -4 ) | ( whole_dig > 6 ) ) ) ) {
 					char buff[50]{ };
 					char *ptr = buff;
+					// The significand from dragonbox does not have the sign
+					if( br.is_negative( ) ) {
+						*ptr++ = '-';
+					}
 					ptr =
 					  daw::jkj::dragonbox::to_chars_detail::to_chars( dec, ptr, digits );
 					out_it.copy_buffer( buff, ptr );
 					return out_it;
-				} else if( fp_output_fmt == options::FPOutputFormat::Auto ) {
-					if( ( whole_dig < -4 ) | ( whole_dig > 6 ) ) {
-						char buff[50]{ };
-						char *ptr = buff;
-						ptr = daw::jkj::dragonbox::to_chars_detail::to_chars( dec, ptr,
-						                                                      digits );
-						out_it.copy_buffer( buff, ptr );
-						return out_it;
-					}
-				}
-				if( br.is_negative( ) ) {
-					out_it.put( '-' );
-				}
-				if( dec.significand == 0 ) {
-					out_it.put( '0' );
-					return out_it;
-				}
-				if( dec.exponent < 0 ) {
-					if( whole_dig < 0 ) {
-						out_it.write( "0." );
-						do {
-							out_it.put( '0' );
-							++whole_dig;
-						} while( whole_dig < 0 );
-						out_it = utils::integer_to_string( out_it, dec.significand );
-						return out_it;
-					}
-					// TODO allow for decimal output for all
-					auto const p1pow =
-					  daw::cxmath::pow10( static_cast<std::size_t>( -dec.exponent ) );
-					auto const p1val = dec.significand / p1pow;
-					out_it = utils::integer_to_string( out_it, p1val );
-					if( p1pow == 1 ) {
-						return out_it;
-					}
-					out_it.put( '.' );
-					auto const p2val = dec.significand - ( p1val * p1pow );
-					out_it = utils::integer_to_string( out_it, p2val );
-					return out_it;
 				}
-				out_it = utils::integer_to_string( out_it, dec.significand );
-				while( dec.exponent > 0 ) {
-					out_it.put( '0' );
-					--dec.exponent;
-				}
-				return out_it;
+				return write_fixed_real<Real>(
+				  out_it, br.is_negative( ), dec.significand, dec.exponent,
+				  static_cast<std::int32_t>( digits ) );
 			}
 		} // namespace json_details
 	}   // namespace DAW_JSON_VER
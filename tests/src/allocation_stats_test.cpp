@@ -0,0 +1,145 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  This test checks that counting_allocator records the allocations of a
+//  parse by type and that counting_output records the growth of the output
+//  when serializing
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_allocation_stats.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using counted_string =
+  std::basic_string<char, std::char_traits<char>,
+                    daw::json::counting_allocator<char>>;
+
+template<typename T>
+using counted_vector = std::vector<T, daw::json::counting_allocator<T>>;
+
+struct Record {
+	counted_string name;
+	counted_vector<int> values;
+	counted_vector<double> weights;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Record> {
+		static constexpr char const name[] = "name";
+		static constexpr char const values[] = "values";
+		static constexpr char const weights[] = "weights";
+		using type =
+		  json_member_list<json_string<name, counted_string>,
+		                   json_array<values, int, counted_vector<int>>,
+		                   json_array<weights, double, counted_vector<double>>>;
+
+		static constexpr auto to_json_data( Record const &v ) {
+			return std::forward_as_tuple( v.name, v.values, v.weights );
+		}
+	};
+} // namespace daw::json
+
+namespace {
+	constexpr std::string_view json_doc = R"json(
+{
+	"name": "a name that is too long for the small string buffer",
+	"values": [ 1, 2, 3, 4, 5, 6, 7, 8 ],
+	"weights": [ 1.5, 2.5 ]
+}
+)json";
+
+	void test_parse( ) {
+		using namespace daw::json;
+		auto stats = allocation_stats( );
+		{
+			auto const rec =
+			  from_json_alloc<Record>( json_doc, counting_allocator<char>( stats ) );
+			test_assert( rec.values.size( ) == 8 and rec.weights.size( ) == 2,
+			             "Unexpected values" );
+			test_assert( &rec.values.get_allocator( ).stats( ) == &stats,
+			             "Expected the vector to use the counting allocator" );
+
+			auto const &total = stats.total( );
+			test_assert( total.allocations >= 3, "Expected the members to allocate" );
+			test_assert( stats.for_type<int>( ).bytes_allocated >= 8 * sizeof( int ),
+			             "Expected the int values to be counted" );
+			test_assert( stats.for_type<double>( ).allocations >= 1,
+			             "Expected the double values to be counted" );
+			test_assert( stats.for_type<char>( ).bytes_allocated >=
+			               rec.name.size( ),
+			             "Expected the name to be counted" );
+			test_assert( stats.by_type( ).size( ) >= 3,
+			             "Expected at least three allocated types" );
+			test_assert( stats.peak_bytes( ) >= total.bytes_in_use( ),
+			             "Unexpected peak" );
+			for( auto const &t : stats.by_type( ) ) {
+				std::cout << t.type_name << ": " << t.counts.allocations
+				          << " allocations, " << t.counts.bytes_allocated
+				          << " bytes\n";
+			}
+		}
+		test_assert( stats.total( ).bytes_in_use( ) == 0,
+		             "Expected everything to be deallocated" );
+		test_assert( stats.total( ).allocations == stats.total( ).deallocations,
+		             "Expected every allocation to be deallocated" );
+	}
+
+	void test_serialize( ) {
+		using namespace daw::json;
+		auto alloc_stats = allocation_stats( );
+		auto const rec = from_json_alloc<Record>(
+		  json_doc, counting_allocator<char>( alloc_stats ) );
+
+		auto stats = output_stats( );
+		auto str = std::string( );
+		(void)to_json( rec, counting_output( str, stats ) );
+		test_assert( stats.bytes_written == str.size( ),
+		             "Expected every byte to be counted" );
+		test_assert( stats.writes > 0 and stats.growths > 0,
+		             "Expected the output to grow" );
+		test_assert( stats.capacity == str.capacity( ), "Unexpected capacity" );
+
+		auto stats2 = output_stats( );
+		auto str2 = std::string( );
+		str2.reserve( str.size( ) );
+		(void)to_json( rec, counting_output( str2, stats2 ) );
+		test_assert( str2 == str, "Expected the same output" );
+		test_assert( stats2.growths == 0,
+		             "Expected a reserved output to not grow" );
+	}
+} // namespace
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	test_parse( );
+	test_serialize( );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
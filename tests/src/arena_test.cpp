@@ -0,0 +1,182 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  This test checks that from_json_arena allocates the strings, arrays and map
+//  nodes of std::pmr types from the arena and that reset reuses its chunks
+//
+
+#include "defines.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string_view>
+
+#if __has_include( <memory_resource> )
+#include <memory_resource>
+#endif
+
+#if defined( __cpp_lib_memory_resource )
+#include <daw/json/daw_json_arena.h>
+#include <daw/json/daw_json_link.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct Item {
+	std::pmr::string name;
+	std::pmr::vector<std::pmr::string> tags;
+	std::pmr::unordered_map<std::pmr::string, int> counts;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Item> {
+		static constexpr char const name[] = "name";
+		static constexpr char const tags[] = "tags";
+		static constexpr char const counts[] = "counts";
+		using type = json_member_list<
+		  json_string<name, std::pmr::string>,
+		  json_array<tags, json_string_no_name<std::pmr::string>,
+		             std::pmr::vector<std::pmr::string>>,
+		  json_key_value<counts, std::pmr::unordered_map<std::pmr::string, int>,
+		                 int, json_string_no_name<std::pmr::string>>>;
+	};
+} // namespace daw::json
+
+namespace {
+	// Counts the chunks the arena requests
+	class counting_resource : public std::pmr::memory_resource {
+		std::size_t m_allocations = 0;
+		std::size_t m_outstanding = 0;
+
+		void *do_allocate( std::size_t bytes, std::size_t alignment ) override {
+			++m_allocations;
+			++m_outstanding;
+			return std::pmr::new_delete_resource( )->allocate( bytes, alignment );
+		}
+
+		void do_deallocate( void *p, std::size_t bytes,
+		                    std::size_t alignment ) override {
+			--m_outstanding;
+			std::pmr::new_delete_resource( )->deallocate( p, bytes, alignment );
+		}
+
+		bool do_is_equal(
+		  std::pmr::memory_resource const &other ) const noexcept override {
+			return this == &other;
+		}
+
+	public:
+		std::size_t allocations( ) const {
+			return m_allocations;
+		}
+
+		std::size_t outstanding( ) const {
+			return m_outstanding;
+		}
+	};
+
+	constexpr std::string_view json_doc = R"json(
+[
+	{
+		"name": "a name that is too long for the small string buffer",
+		"tags": [ "first tag that does not fit in sso", "second tag that does not fit in sso" ],
+		"counts": { "a key that does not fit in the sso buffer": 1, "b": 2 }
+	},
+	{
+		"name": "b",
+		"tags": [ ],
+		"counts": { }
+	}
+]
+)json";
+
+	void test_parse( ) {
+		using namespace daw::json;
+		auto upstream = counting_resource( );
+		{
+			auto mem = arena( 64U * 1024U, &upstream );
+			for( int n = 0; n < 3; ++n ) {
+				{
+					auto const items =
+					  from_json_arena<std::pmr::vector<Item>>( json_doc, mem );
+					test_assert( items.size( ) == 2, "Expected 2 items" );
+					test_assert( items.get_allocator( ).resource( ) == &mem,
+					             "Expected the array to use the arena" );
+					auto const &item = items[0];
+					test_assert( item.name.get_allocator( ).resource( ) == &mem,
+					             "Expected the string to use the arena" );
+					test_assert( item.tags.size( ) == 2 and
+					               item.tags[1] == "second tag that does not fit in sso",
+					             "Unexpected tags" );
+					test_assert( item.tags.get_allocator( ).resource( ) == &mem and
+					               item.tags[0].get_allocator( ).resource( ) == &mem,
+					             "Expected the tags to use the arena" );
+					test_assert( item.counts.size( ) == 2 and
+					               item.counts.get_allocator( ).resource( ) == &mem,
+					             "Expected the map to use the arena" );
+					auto const pos =
+					  item.counts.find( "a key that does not fit in the sso buffer" );
+					test_assert( pos != item.counts.end( ) and pos->second == 1 and
+					               pos->first.get_allocator( ).resource( ) == &mem,
+					             "Expected the map keys to use the arena" );
+					test_assert( items[1].tags.empty( ) and items[1].counts.empty( ),
+					             "Expected empty members" );
+					test_assert( mem.bytes_used( ) > 0, "Expected arena allocations" );
+				}
+				// The whole document fits in the first chunk and reset reuses it
+				test_assert( upstream.allocations( ) == 1,
+				             "Expected a single upstream allocation" );
+				mem.reset( );
+				test_assert( mem.bytes_used( ) == 0, "Expected an empty arena" );
+			}
+
+			// Allocations larger than the chunk size get a chunk of their own
+			void *p = mem.allocate( 1024U * 1024U, 64U );
+			test_assert( reinterpret_cast<std::uintptr_t>( p ) % 64U == 0,
+			             "Expected an aligned allocation" );
+			test_assert( upstream.allocations( ) == 2 and
+			               mem.capacity( ) >= 1024U * 1024U,
+			             "Expected a new chunk" );
+			mem.release( );
+			test_assert( upstream.outstanding( ) == 0 and mem.capacity( ) == 0,
+			             "Expected release to return the chunks" );
+			(void)mem.allocate( 16U );
+		}
+		test_assert( upstream.outstanding( ) == 0,
+		             "Expected the arena to return its chunks" );
+	}
+} // namespace
+#endif
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+#if defined( __cpp_lib_memory_resource )
+	test_parse( );
+#else
+	std::cout << "std::pmr is not available, skipping\n";
+#endif
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
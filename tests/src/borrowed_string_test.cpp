@@ -0,0 +1,160 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  This test checks that borrowed_string refers to the document for strings
+//  without escapes and decodes those with escapes.  It benchmarks parsing
+//  strings to borrowed_string against std::string
+//
+
+#include "defines.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 100;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+struct Message {
+	daw::json::borrowed_string user;
+	daw::json::borrowed_string text;
+	std::vector<daw::json::borrowed_string> tags;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Message> {
+		static constexpr char const user[] = "user";
+		static constexpr char const text[] = "text";
+		static constexpr char const tags[] = "tags";
+		using type = json_member_list<json_string<user, borrowed_string>,
+		                              json_string<text, borrowed_string>,
+		                              json_array<tags, borrowed_string>>;
+
+		static constexpr auto to_json_data( Message const &m ) {
+			return std::forward_as_tuple( m.user, m.text, m.tags );
+		}
+	};
+} // namespace daw::json
+
+namespace {
+	bool is_in( daw::json::borrowed_string const &str, std::string_view doc ) {
+		return str.data( ) >= doc.data( ) and
+		       str.data( ) + str.size( ) <= doc.data( ) + doc.size( );
+	}
+
+	void test_borrowed( ) {
+		using namespace daw::json;
+		constexpr std::string_view json_doc = R"json(
+{
+	"user": "a user",
+	"text": "a \"quoted\" tab\t and ümlaut",
+	"tags": [ "plain", "escaped\\/", "" ]
+}
+)json";
+		auto const msg = from_json<Message>( json_doc );
+		test_assert( msg.user == "a user", "Unexpected user" );
+		test_assert( msg.user.is_borrowed( ) and is_in( msg.user, json_doc ),
+		             "Expected the user to refer to the document" );
+		test_assert( msg.text == "a \"quoted\" tab\t and \xC3\xBCmlaut",
+		             "Unexpected text" );
+		test_assert( not msg.text.is_borrowed( ),
+		             "Expected the text to be decoded" );
+		test_assert( msg.tags.size( ) == 3, "Expected 3 tags" );
+		test_assert( msg.tags[0].is_borrowed( ) and msg.tags[0] == "plain",
+		             "Unexpected tag" );
+		test_assert( not msg.tags[1].is_borrowed( ) and
+		               msg.tags[1] == "escaped\\/",
+		             "Unexpected tag" );
+		test_assert( msg.tags[2].empty( ), "Expected an empty tag" );
+
+		// Copies of decoded strings own their text
+		auto const copy = msg;
+		test_assert( copy.text == msg.text and copy.text.data( ) != msg.text.data( ),
+		             "Unexpected copy" );
+
+		auto const json_out = to_json( msg );
+		auto const msg2 = from_json<Message>( json_out );
+		test_assert( msg2.text == msg.text and msg2.tags == msg.tags,
+		             "Round trip mismatch" );
+	}
+
+	std::string make_strings( std::size_t count ) {
+		auto result = std::string( "[" );
+		for( std::size_t n = 0; n < count; ++n ) {
+			if( n > 0 ) {
+				result += ',';
+			}
+			if( n % 16U == 0 ) {
+				result += R"("a string with an \"escape\" in it)";
+			} else {
+				result += R"("a string long enough to not be in the sso buffer")";
+			}
+		}
+		result += ']';
+		return result;
+	}
+} // namespace
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	test_borrowed( );
+
+	auto const json_data = make_strings( 100'000 );
+	auto const json_sv = std::string_view( json_data );
+	auto const expected = from_json<std::vector<std::string>>( json_sv );
+	auto const borrowed = from_json<std::vector<borrowed_string>>( json_sv );
+	test_assert( expected.size( ) == borrowed.size( ), "Size mismatch" );
+	for( std::size_t n = 0; n < expected.size( ); ++n ) {
+		test_assert( borrowed[n] == expected[n], "Value mismatch" );
+	}
+
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "std::string", json_sv.size( ),
+	  []( std::string_view sv ) {
+		  auto result = from_json<std::vector<std::string>>( sv );
+		  daw::do_not_optimize( result );
+	  },
+	  json_sv );
+
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "borrowed_string", json_sv.size( ),
+	  []( std::string_view sv ) {
+		  auto result = from_json<std::vector<borrowed_string>>( sv );
+		  daw::do_not_optimize( result );
+	  },
+	  json_sv );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
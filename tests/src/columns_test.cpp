@@ -0,0 +1,175 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  This test checks that from_json_columns parses an array of mapped classes
+//  into one column per member, with validity bitmaps for nullable members, and
+//  benchmarks it against parsing to std::vector<Record>
+//
+
+#include "defines.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/json/daw_json_columns.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 100;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+struct Trade {
+	std::int64_t id;
+	double price;
+	std::string symbol;
+	std::optional<int> quantity;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Trade> {
+		static constexpr char const id[] = "id";
+		static constexpr char const price[] = "price";
+		static constexpr char const symbol[] = "symbol";
+		static constexpr char const quantity[] = "quantity";
+		using type = json_member_list<json_number<id, std::int64_t>,
+		                              json_number<price>, json_string<symbol>,
+		                              json_number_null<quantity, std::optional<int>>>;
+	};
+} // namespace daw::json
+
+namespace {
+	void test_columns( ) {
+		using namespace daw::json;
+		constexpr std::string_view json_doc = R"json(
+[
+	{ "id": 1, "price": 1.5, "symbol": "ABC", "quantity": 100 },
+	{ "quantity": null, "symbol": "DEF", "price": 2.25, "id": 2 },
+	{ "id": 3, "price": 3.0, "symbol": "GHI" }
+]
+)json";
+		auto const trades = from_json_columns<Trade>( json_doc );
+		test_assert( trades.size( ) == 3, "Expected 3 records" );
+		static_assert( record_columns<Trade>::column_count == 4 );
+
+		auto const &ids = trades.column<0>( );
+		test_assert( ids.size( ) == 3 and ids[0] == 1 and ids[1] == 2 and
+		               ids[2] == 3,
+		             "Unexpected ids" );
+		test_assert( ids.values( ).capacity( ) == 3,
+		             "Expected the column to be sized for the records" );
+		auto const &prices = trades.column<1>( );
+		test_assert( prices[1] == 2.25, "Unexpected price" );
+		auto const &symbols = trades.column<2>( );
+		test_assert( symbols[0] == "ABC" and symbols[2] == "GHI",
+		             "Unexpected symbols" );
+
+		auto const &quantities = trades.column<3>( );
+		test_assert( quantities.size( ) == 3 and quantities.null_count( ) == 2,
+		             "Expected 2 null quantities" );
+		test_assert( quantities.has_value( 0 ) and quantities[0] == 100,
+		             "Unexpected quantity" );
+		test_assert( not quantities.has_value( 1 ) and
+		               not quantities.has_value( 2 ) and quantities[1] == 0,
+		             "Expected null quantities" );
+		test_assert( quantities.validity( ).size( ) == 1 and
+		               quantities.validity( )[0] == 1U,
+		             "Unexpected validity bitmap" );
+
+		auto const empty = from_json_columns<Trade>( std::string_view( "[]" ) );
+		test_assert( empty.empty( ) and empty.column<3>( ).validity( ).empty( ),
+		             "Expected no records" );
+	}
+
+	std::string make_trades( std::size_t count ) {
+		auto result = std::string( "[" );
+		for( std::size_t n = 0; n < count; ++n ) {
+			if( n > 0 ) {
+				result += ',';
+			}
+			result += R"({"id":)";
+			result += std::to_string( n );
+			result += R"(,"price":)";
+			result += std::to_string( static_cast<double>( n % 1000U ) / 8.0 );
+			result += R"(,"symbol":"SYM)";
+			result += std::to_string( n % 100U );
+			result += R"(","quantity":)";
+			result += n % 10U == 0 ? "null" : std::to_string( n % 500U );
+			result += '}';
+		}
+		result += ']';
+		return result;
+	}
+} // namespace
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	test_columns( );
+
+	auto const json_data = make_trades( 100'000 );
+	auto const json_sv = std::string_view( json_data );
+	{
+		auto const rows = from_json<std::vector<Trade>>( json_sv );
+		auto const cols = from_json_columns<Trade>( json_sv );
+		test_assert( rows.size( ) == cols.size( ), "Size mismatch" );
+		for( std::size_t n = 0; n < rows.size( ); ++n ) {
+			test_assert( rows[n].id == cols.column<0>( )[n] and
+			               rows[n].price == cols.column<1>( )[n] and
+			               rows[n].symbol == cols.column<2>( )[n] and
+			               rows[n].quantity.has_value( ) ==
+			                 cols.column<3>( ).has_value( n ),
+			             "Value mismatch" );
+		}
+		test_assert( cols.column<3>( ).null_count( ) == 10'000,
+		             "Unexpected null count" );
+	}
+
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "std::vector<Trade>", json_sv.size( ),
+	  []( std::string_view sv ) {
+		  auto result = from_json<std::vector<Trade>>( sv );
+		  daw::do_not_optimize( result );
+	  },
+	  json_sv );
+
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "record_columns<Trade>", json_sv.size( ),
+	  []( std::string_view sv ) {
+		  auto result = from_json_columns<Trade>( sv );
+		  daw::do_not_optimize( result );
+	  },
+	  json_sv );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
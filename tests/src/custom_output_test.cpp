@@ -0,0 +1,209 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  This test checks that json_custom members write directly to the output
+//  when the converter or type supports it, and benchmarks that against
+//  converting to a std::string first
+//
+
+#include "defines.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 100;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+namespace custom_output {
+	struct ipv4 {
+		std::uint32_t value = 0;
+	};
+
+	bool operator==( ipv4 const &lhs, ipv4 const &rhs ) {
+		return lhs.value == rhs.value;
+	}
+
+	ipv4 from_string( daw::tag_t<ipv4>, std::string_view sv ) {
+		std::uint32_t result = 0;
+		for( int n = 0; n < 4; ++n ) {
+			auto const pos = sv.find( '.' );
+			auto const octet =
+			  daw::json::from_json<unsigned, true>( sv.substr( 0, pos ) );
+			result = ( result << 8U ) | octet;
+			sv.remove_prefix( pos == std::string_view::npos ? sv.size( )
+			                                                : pos + 1 );
+		}
+		return ipv4{ result };
+	}
+
+	/// Found via ADL by the default ToJsonConverter
+	template<typename WritableType>
+	constexpr WritableType to_json_output( WritableType it, ipv4 const &ip ) {
+		for( int shift = 24; shift >= 0; shift -= 8 ) {
+			it = daw::json::utils::integer_to_string(
+			  it, static_cast<unsigned>( ( ip.value >> shift ) & 0xFFU ) );
+			if( shift > 0 ) {
+				it.put( '.' );
+			}
+		}
+		return it;
+	}
+
+	/// The string returning converter used before to_json_output
+	struct ipv4_to_string {
+		std::string operator( )( ipv4 const &ip ) const {
+			std::stringstream ss{ };
+			ss << ( ( ip.value >> 24U ) & 0xFFU ) << '.'
+			   << ( ( ip.value >> 16U ) & 0xFFU ) << '.'
+			   << ( ( ip.value >> 8U ) & 0xFFU ) << '.' << ( ip.value & 0xFFU );
+			return ss.str( );
+		}
+	};
+
+	/// A fixed point value with 2 decimal places, stored as cents
+	struct money {
+		std::int64_t cents = 0;
+	};
+
+	struct money_converter {
+		money operator( )( std::string_view sv ) const {
+			bool const is_negative = sv.front( ) == '-';
+			if( is_negative ) {
+				sv.remove_prefix( 1 );
+			}
+			auto const pos = sv.find( '.' );
+			auto const whole =
+			  daw::json::from_json<std::int64_t, true>( sv.substr( 0, pos ) );
+			auto const frac =
+			  daw::json::from_json<std::int64_t, true>( sv.substr( pos + 1 ) );
+			auto const cents = whole * 100 + frac;
+			return money{ is_negative ? -cents : cents };
+		}
+
+		template<typename WritableType>
+		constexpr WritableType operator( )( WritableType it,
+		                                    money const &m ) const {
+			auto cents = m.cents;
+			if( cents < 0 ) {
+				it.put( '-' );
+				cents = -cents;
+			}
+			it = daw::json::utils::integer_to_string( it, cents / 100 );
+			it.put( '.' );
+			if( cents % 100 < 10 ) {
+				it.put( '0' );
+			}
+			return daw::json::utils::integer_to_string( it, cents % 100 );
+		}
+	};
+
+	using ip_t = daw::json::json_custom_no_name<ipv4>;
+	using ip_string_t =
+	  daw::json::json_custom_no_name<ipv4, daw::json::use_default,
+	                                 ipv4_to_string>;
+	using money_t =
+	  daw::json::json_custom_lit_no_name<money, money_converter,
+	                                     money_converter>;
+	using int_t = daw::json::json_custom_no_name<int>;
+
+	static_assert( daw::json::json_details::has_to_json_output_v<
+	               daw::json::serialization_policy<std::string>, ipv4> );
+
+	void test_output( ) {
+		using namespace daw::json;
+		test_assert( to_json<ip_t>( ipv4{ 0xC0A8'0001U } ) == R"("192.168.0.1")",
+		             "Unexpected to_json_output result" );
+		test_assert( to_json<ip_string_t>( ipv4{ 0xC0A8'0001U } ) ==
+		               R"("192.168.0.1")",
+		             "Unexpected string converter result" );
+		test_assert( to_json<money_t>( money{ -1205 } ) == "-12.05",
+		             "Unexpected direct literal converter result" );
+		test_assert( from_json<money_t>( std::string_view( "-12.05" ) ).cents ==
+		               -1205,
+		             "Unexpected money parse" );
+		test_assert( to_json<int_t>( -42 ) == R"("-42")",
+		             "Unexpected integer result" );
+		test_assert( from_json<int_t>( std::string_view( R"("-42")" ) ) == -42,
+		             "Unexpected integer parse" );
+	}
+
+	std::vector<ipv4> make_addresses( std::size_t count ) {
+		auto rnd = std::mt19937( 42 );
+		auto result = std::vector<ipv4>( count );
+		for( auto &ip : result ) {
+			ip.value = static_cast<std::uint32_t>( rnd( ) );
+		}
+		return result;
+	}
+
+	template<typename JsonElement>
+	std::string bench( std::string_view title, std::vector<ipv4> const &values,
+	                   std::size_t bytes ) {
+		using namespace daw::json;
+		auto out = std::string( );
+		out.reserve( bytes );
+		(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  title, bytes,
+		  [&]( std::vector<ipv4> const &v ) {
+			  out.clear( );
+			  (void)to_json_array<JsonElement>( v, out );
+			  daw::do_not_optimize( out );
+		  },
+		  values );
+		return out;
+	}
+} // namespace custom_output
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace custom_output;
+	test_output( );
+
+	auto const values = make_addresses( 100'000 );
+	std::string const json_data = daw::json::to_json_array<ip_t>( values );
+	test_assert( daw::json::from_json_array<ip_t>(
+	               std::string_view( json_data ) ) == values,
+	             "Expected the addresses to round trip" );
+
+	auto const direct =
+	  bench<ip_t>( "to_json_output", values, json_data.size( ) );
+	auto const via_string =
+	  bench<ip_string_t>( "std::string converter", values, json_data.size( ) );
+	test_assert( direct == json_data and via_string == json_data,
+	             "Expected the same output" );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,193 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  This test checks the output of json_date serialization, that it round
+//  trips, and benchmarks serializing log like and random timestamps
+//
+
+#include "defines.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/json/daw_json_link.h>
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 100;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+using timestamp_t =
+  std::chrono::time_point<std::chrono::system_clock, std::chrono::milliseconds>;
+
+struct Span {
+	timestamp_t start;
+	timestamp_t end;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Span> {
+		static constexpr char const start[] = "start";
+		static constexpr char const end[] = "end";
+		using type = json_member_list<json_date<start, timestamp_t>,
+		                              json_date<end, timestamp_t>>;
+
+		static constexpr auto to_json_data( Span const &v ) {
+			return std::forward_as_tuple( v.start, v.end );
+		}
+	};
+} // namespace daw::json
+
+// The prefix cache is shared by the copies of the policy, not held in it
+static_assert( sizeof( daw::json::serialization_policy<std::string> ) <=
+                 3 * sizeof( void * ),
+               "Expected serialization_policy to stay small" );
+
+namespace {
+	using date_t = daw::json::json_date_no_name<timestamp_t>;
+
+	timestamp_t from_ms( std::int64_t ms ) {
+		return timestamp_t( std::chrono::milliseconds( ms ) );
+	}
+
+	std::string serialize( timestamp_t ts ) {
+		return daw::json::to_json<date_t>( ts );
+	}
+
+	void test_output( ) {
+		test_assert( serialize( from_ms( 0 ) ) == R"("1970-01-01T00:00:00Z")",
+		             "Unexpected epoch" );
+		test_assert( serialize( from_ms( 1'578'965'674'443 ) ) ==
+		               R"("2020-01-14T01:34:34.443Z")",
+		             "Unexpected timestamp" );
+		test_assert( serialize( from_ms( 1'578'965'674'005 ) ) ==
+		               R"("2020-01-14T01:34:34.005Z")",
+		             "Expected the milliseconds to be 3 digits" );
+		test_assert( serialize( from_ms( -1 ) ) == R"("1969-12-31T23:59:59.999Z")",
+		             "Unexpected timestamp before the epoch" );
+		test_assert( serialize( from_ms( -62'009'366'400'000 ) ) ==
+		               R"("0005-01-01T00:00:00Z")",
+		             "Expected the year to be 4 digits" );
+	}
+
+	/// Consecutive timestamps either side of an hour and day boundary must
+	/// not reuse the previous prefix
+	void test_cached_prefix( ) {
+		using namespace daw::json;
+		auto const values = std::vector<timestamp_t>{
+		  from_ms( 3'599'999 ), from_ms( 3'600'000 ), from_ms( 3'599'999 ),
+		  from_ms( 86'399'999 ), from_ms( 86'400'000 ), from_ms( 90'000'000 ),
+		  from_ms( 3'600'000 ) };
+		auto const json_data = to_json_array<date_t>( values );
+		test_assert( json_data == R"(["1970-01-01T00:59:59.999Z",)"
+		                          R"("1970-01-01T01:00:00Z",)"
+		                          R"("1970-01-01T00:59:59.999Z",)"
+		                          R"("1970-01-01T23:59:59.999Z",)"
+		                          R"("1970-01-02T00:00:00Z",)"
+		                          R"("1970-01-02T01:00:00Z",)"
+		                          R"("1970-01-01T01:00:00Z"])",
+		             "Unexpected output" );
+	}
+
+	/// Class members are serialized through copies of the policy
+	void test_class_members( ) {
+		using namespace daw::json;
+		auto const values =
+		  std::vector<Span>{ { from_ms( 3'599'999 ), from_ms( 3'600'000 ) },
+		                     { from_ms( 3'600'001 ), from_ms( 3'599'999 ) } };
+		auto const json_data = to_json_array( values );
+		test_assert( json_data == R"([{"start":"1970-01-01T00:59:59.999Z",)"
+		                          R"("end":"1970-01-01T01:00:00Z"},)"
+		                          R"({"start":"1970-01-01T01:00:00.001Z",)"
+		                          R"("end":"1970-01-01T00:59:59.999Z"}])",
+		             "Unexpected output" );
+	}
+
+	std::vector<timestamp_t> make_log_timestamps( std::size_t count ) {
+		auto rnd = std::mt19937( 42 );
+		auto result = std::vector<timestamp_t>( );
+		result.reserve( count );
+		std::int64_t ms = 1'600'000'000'000;
+		for( std::size_t n = 0; n < count; ++n ) {
+			ms += static_cast<std::int64_t>( rnd( ) % 50U );
+			result.push_back( from_ms( ms ) );
+		}
+		return result;
+	}
+
+	std::vector<timestamp_t> make_random_timestamps( std::size_t count ) {
+		auto rnd = std::mt19937_64( 42 );
+		auto result = std::vector<timestamp_t>( );
+		result.reserve( count );
+		for( std::size_t n = 0; n < count; ++n ) {
+			// Years 1970 through 9999
+			result.push_back( from_ms(
+			  static_cast<std::int64_t>( rnd( ) % 253'402'300'800'000ULL ) ) );
+		}
+		return result;
+	}
+
+	void bench( std::string_view title, std::vector<timestamp_t> const &values ) {
+		using namespace daw::json;
+		std::string const json_data = to_json_array<date_t>( values );
+		test_assert( from_json_array<date_t>( std::string_view( json_data ) ) ==
+		               values,
+		             "Expected the timestamps to round trip" );
+
+		auto out = std::string( );
+		out.reserve( json_data.size( ) );
+		(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  title, json_data.size( ),
+		  [&]( std::vector<timestamp_t> const &v ) {
+			  out.clear( );
+			  (void)to_json_array<date_t>( v, out );
+			  daw::do_not_optimize( out );
+		  },
+		  values );
+		test_assert( out == json_data, "Expected the same output" );
+	}
+} // namespace
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	test_output( );
+	test_cached_prefix( );
+	test_class_members( );
+
+	constexpr std::size_t count = 100'000;
+	bench( "serialize log timestamps", make_log_timestamps( count ) );
+	bench( "serialize random timestamps", make_random_timestamps( count ) );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
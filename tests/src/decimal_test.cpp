@@ -0,0 +1,218 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  This test checks that json_decimal keeps the exact digits of numbers,
+//  reports overflow, and benchmarks it against parsing double
+//
+
+#include "defines.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 100;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+namespace decimal_test {
+	using daw::json::decimal64;
+
+	struct Trade {
+		std::string symbol;
+		decimal64 price;
+		std::optional<decimal64> fee;
+	};
+
+	bool operator==( Trade const &lhs, Trade const &rhs ) {
+		return lhs.symbol == rhs.symbol and lhs.price == rhs.price and
+		       lhs.fee == rhs.fee;
+	}
+} // namespace decimal_test
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<decimal_test::Trade> {
+#ifdef DAW_JSON_CNTTP_JSON_NAME
+		using type =
+		  json_member_list<json_string<"symbol">, json_decimal<"price">,
+		                   json_decimal_null<"fee">>;
+#else
+		static constexpr char const symbol[] = "symbol";
+		static constexpr char const price[] = "price";
+		static constexpr char const fee[] = "fee";
+		using type = json_member_list<json_string<symbol>, json_decimal<price>,
+		                              json_decimal_null<fee>>;
+#endif
+		static inline auto to_json_data( decimal_test::Trade const &value ) {
+			return std::forward_as_tuple( value.symbol, value.price, value.fee );
+		}
+	};
+} // namespace daw::json
+
+namespace decimal_test {
+	using decimal_t = daw::json::json_decimal_no_name<>;
+
+	decimal64 parse( std::string_view sv ) {
+		return daw::json::from_json<decimal_t>( sv );
+	}
+
+	void test_values( ) {
+		using namespace daw::json;
+		test_assert( parse( "0.1" ) == decimal64{ 1, -1 }, "Unexpected 0.1" );
+		test_assert( parse( "1.50" ) == decimal64{ 150, -2 },
+		             "Expected the trailing zero to be kept" );
+		test_assert( parse( "-12.345e2" ) == decimal64{ -12345, -1 },
+		             "Unexpected exponent" );
+		test_assert( parse( "9223372036854775807" ) ==
+		               decimal64{ 9223372036854775807LL, 0 },
+		             "Unexpected max" );
+		test_assert( to_json<decimal_t>( decimal64{ 150, -2 } ) == "1.50",
+		             "Unexpected output" );
+		test_assert( to_json<decimal_t>( decimal64{ -5, -3 } ) == "-0.005",
+		             "Unexpected output" );
+		test_assert( to_json<decimal_t>( decimal64{ 5, -10 } ) == "5e-10",
+		             "Unexpected output" );
+		test_assert( to_json<decimal_t>( decimal64{ 12, 3 } ) == "12e3",
+		             "Unexpected output" );
+#if defined( DAW_HAS_INT128 )
+		using decimal128_t = json_decimal_no_name<decimal128>;
+		constexpr std::string_view big = "12345678901234567890.123456789012345678";
+		test_assert( to_json<decimal128_t>( from_json<decimal128_t>( big ) ) ==
+		               big,
+		             "Expected the 38 digits to round trip" );
+#endif
+	}
+
+	bool has_error( std::string_view json_data,
+	                daw::json::ErrorReason reason ) {
+#ifdef DAW_USE_EXCEPTIONS
+		try {
+			(void)parse( json_data );
+		} catch( daw::json::json_exception const &jex ) {
+			return jex.reason_type( ) == reason;
+		}
+		return false;
+#else
+		(void)json_data;
+		(void)reason;
+		return true;
+#endif
+	}
+
+	void test_errors( ) {
+		using daw::json::ErrorReason;
+		test_assert(
+		  has_error( "9223372036854775808", ErrorReason::NumberOutOfRange ),
+		  "Expected the significand to overflow" );
+		test_assert( has_error( "1.00000000000000000000",
+		                        ErrorReason::NumberOutOfRange ),
+		             "Expected the significand to overflow" );
+		test_assert( has_error( "1e99999999999", ErrorReason::NumberOutOfRange ),
+		             "Expected the exponent to overflow" );
+	}
+
+	void test_trade( ) {
+		using namespace daw::json;
+		constexpr std::string_view json_data =
+		  R"({"symbol":"ABC","price":101.10,"fee":0.0025})";
+		auto const trade = from_json<Trade>( json_data );
+		test_assert( trade.price == decimal64{ 10110, -2 }, "Unexpected price" );
+		test_assert( trade.fee == decimal64{ 25, -4 }, "Unexpected fee" );
+		test_assert( to_json( trade ) == json_data, "Expected the same JSON" );
+		auto const no_fee = Trade{ "XYZ", decimal64{ 7, 0 }, std::nullopt };
+		test_assert( from_json<Trade>( to_json( no_fee ) ) == no_fee,
+		             "Expected the trade to round trip" );
+	}
+
+	std::string make_prices_doc( std::size_t count ) {
+		auto rnd = std::mt19937( 42 );
+		std::string result = "[";
+		char buff[32];
+		for( std::size_t n = 0; n < count; ++n ) {
+			if( n > 0 ) {
+				result += ',';
+			}
+			std::snprintf( buff, sizeof( buff ), "%u.%04u", rnd( ) % 100000U,
+			               rnd( ) % 10000U );
+			result += buff;
+		}
+		result += ']';
+		return result;
+	}
+} // namespace decimal_test
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace decimal_test;
+	using namespace daw::json;
+	test_values( );
+	test_errors( );
+	test_trade( );
+
+	auto const json_data = make_prices_doc( 1'000'000 );
+	auto const json_sv = std::string_view( json_data );
+
+	auto decimals = std::vector<decimal64>( );
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "parse json_decimal", json_sv.size( ),
+	  [&]( std::string_view sv ) {
+		  decimals = from_json_array<decimal_t>( sv );
+		  daw::do_not_optimize( decimals );
+	  },
+	  json_sv );
+
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "parse double", json_sv.size( ),
+	  [&]( std::string_view sv ) {
+		  auto result = from_json_array<double>( sv );
+		  daw::do_not_optimize( result );
+	  },
+	  json_sv );
+
+	auto out = std::string( );
+	out.reserve( json_sv.size( ) );
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "serialize json_decimal", json_sv.size( ),
+	  [&]( std::vector<decimal64> const &v ) {
+		  out.clear( );
+		  (void)to_json_array<decimal_t>( v, out );
+		  daw::do_not_optimize( out );
+	  },
+	  decimals );
+	test_assert( out == json_data, "Expected the same text" );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,145 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  This checks that millions of random float values round trip and parse as
+//  strtof does, and benchmarks parsing and serializing large arrays of float.
+//  float32_test has the same checks with fewer values
+//
+
+#include "defines.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 10;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t NUM_FLOATS = 10'000'000;
+#else
+static inline constexpr std::size_t NUM_FLOATS = 10'000;
+#endif
+
+namespace {
+	bool is_same_bits( float lhs, float rhs ) {
+		return std::memcmp( &lhs, &rhs, sizeof( float ) ) == 0;
+	}
+
+	float random_finite_float( std::mt19937 &rnd ) {
+		while( true ) {
+			auto const bits = static_cast<std::uint32_t>( rnd( ) );
+			float f;
+			std::memcpy( &f, &bits, sizeof( float ) );
+			if( std::isfinite( f ) ) {
+				return f;
+			}
+		}
+	}
+
+	void test_round_trip( ) {
+		auto rnd = std::mt19937( 0xF10A7 );
+		for( std::size_t n = 0; n < 1'000'000; ++n ) {
+			float const f = random_finite_float( rnd );
+			auto const str = daw::json::to_json( f );
+			auto const f2 = daw::json::from_json<float>( str );
+			if( not is_same_bits( f, f2 ) ) {
+				std::cerr << "Round trip of " << str << " failed\n";
+			}
+			test_assert( is_same_bits( f, f2 ), "Expected the float to round trip" );
+		}
+	}
+
+	/// Parsing float rounds once, as strtof does
+	void test_parse_matches_strtof( ) {
+		auto rnd = std::mt19937( 0xC0FFEE );
+		char buff[64];
+		for( std::size_t n = 0; n < 1'000'000; ++n ) {
+			float const f = random_finite_float( rnd );
+			std::snprintf( buff, sizeof( buff ), "%.8e", static_cast<double>( f ) );
+			auto const expected = std::strtof( buff, nullptr );
+			auto const result =
+			  daw::json::from_json<float>( std::string_view( buff ) );
+			test_assert( is_same_bits( result, expected ),
+			             "Expected the correctly rounded float" );
+		}
+	}
+} // namespace
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	test_round_trip( );
+	test_parse_matches_strtof( );
+
+	using namespace daw::json;
+	auto values = std::vector<float>( NUM_FLOATS );
+	{
+		auto rnd = std::mt19937( 42 );
+		auto dist = std::uniform_real_distribution<float>( -1.0f, 1.0f );
+		for( auto &v : values ) {
+			v = dist( rnd );
+		}
+	}
+	std::string const json_data = to_json_array( values );
+	auto const json_sv = std::string_view( json_data );
+	std::cout << NUM_FLOATS << " floats, " << json_sv.size( ) << " bytes\n";
+
+	auto result = std::vector<float>( );
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "parse float array", json_sv.size( ),
+	  [&]( std::string_view sv ) {
+		  result = from_json_array<float>( sv );
+		  daw::do_not_optimize( result );
+	  },
+	  json_sv );
+	test_assert( result == values, "Expected the values to round trip" );
+
+	auto out = std::string( );
+	out.reserve( json_sv.size( ) );
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "serialize float array", json_sv.size( ),
+	  [&]( std::vector<float> const &v ) {
+		  out.clear( );
+		  (void)to_json_array( v, out );
+		  daw::do_not_optimize( out );
+	  },
+	  values );
+	test_assert( out == json_data, "Expected the same output" );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,145 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  This test checks that float values round trip through to_json/from_json,
+//  that the output is the shortest form and that edge values parse as strtof
+//  does.  float32_bench checks millions of values and benchmarks
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+
+static inline constexpr std::size_t NUM_CHECKS = 10'000;
+
+namespace {
+	bool is_same_bits( float lhs, float rhs ) {
+		return std::memcmp( &lhs, &rhs, sizeof( float ) ) == 0;
+	}
+
+	float random_finite_float( std::mt19937 &rnd ) {
+		while( true ) {
+			auto const bits = static_cast<std::uint32_t>( rnd( ) );
+			float f;
+			std::memcpy( &f, &bits, sizeof( float ) );
+			if( std::isfinite( f ) ) {
+				return f;
+			}
+		}
+	}
+
+	void test_round_trip( ) {
+		auto rnd = std::mt19937( 0xF10A7 );
+		for( std::size_t n = 0; n < NUM_CHECKS; ++n ) {
+			float const f = random_finite_float( rnd );
+			auto const str = daw::json::to_json( f );
+			auto const f2 = daw::json::from_json<float>( str );
+			if( not is_same_bits( f, f2 ) ) {
+				std::cerr << "Round trip of " << str << " failed\n";
+			}
+			test_assert( is_same_bits( f, f2 ), "Expected the float to round trip" );
+		}
+	}
+
+	/// Parsing float rounds once, as strtof does
+	void test_parse_matches_strtof( ) {
+		auto rnd = std::mt19937( 0xC0FFEE );
+		char buff[64];
+		for( std::size_t n = 0; n < NUM_CHECKS; ++n ) {
+			float const f = random_finite_float( rnd );
+			std::snprintf( buff, sizeof( buff ), "%.8e", static_cast<double>( f ) );
+			auto const expected = std::strtof( buff, nullptr );
+			auto const result =
+			  daw::json::from_json<float>( std::string_view( buff ) );
+			test_assert( is_same_bits( result, expected ),
+			             "Expected the correctly rounded float" );
+		}
+	}
+
+	/// Subnormals, the limits and values whose nine digit form is close to
+	/// half way between two floats
+	void test_edge_values( ) {
+		constexpr std::string_view values[] = {
+		  "1e-45",          "1.4e-45",        "7e-46",
+		  "1.1754942e-38",  "1.17549435e-38", "3.4028235e38",
+		  "3.40282357e38",  "16777217",       "33554435",
+		  "1.00000006",     "0.30000001",     "9.99999974e-6",
+		  "4.2949673e9",    "1e-50" };
+		for( auto sv : values ) {
+			auto const str = std::string( sv );
+			auto const expected = std::strtof( str.c_str( ), nullptr );
+			auto const result = daw::json::from_json<float>( sv );
+			if( not is_same_bits( result, expected ) ) {
+				std::cerr << "Parsing " << sv << " failed\n";
+			}
+			test_assert( is_same_bits( result, expected ),
+			             "Expected the correctly rounded float" );
+			auto const f2 =
+			  daw::json::from_json<float>( daw::json::to_json( result ) );
+			test_assert( is_same_bits( result, f2 ),
+			             "Expected the float to round trip" );
+		}
+	}
+
+	void test_output( ) {
+		using namespace daw::json;
+		test_assert( to_json( 0.1f ) == "0.1", "Expected the shortest digits" );
+		test_assert( to_json( 1.05f ) == "1.05",
+		             "Expected the zeros after the decimal point" );
+		test_assert( to_json( -0.5f ) == "-0.5", "Unexpected output" );
+		test_assert( to_json( 16777216.0f ) == "1.6777216e7",
+		             "Unexpected output" );
+		test_assert( to_json( -16777216.0f ) == "-1.6777216e7",
+		             "Expected the sign in scientific output" );
+		test_assert( to_json( 3.4028235e38f ) == "3.4028235e38",
+		             "Unexpected output" );
+		using decimal_float_t = json_number_no_name<
+		  float, options::number_opt( options::FPOutputFormat::Decimal )>;
+		test_assert( to_json<decimal_float_t>( 1e-10f ) == "0.0000000001",
+		             "Unexpected decimal output" );
+		test_assert( to_json<decimal_float_t>( 1e20f ) ==
+		               "100000000000000000000",
+		             "Unexpected decimal output" );
+	}
+} // namespace
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	test_output( );
+	test_round_trip( );
+	test_parse_matches_strtof( );
+	test_edge_values( );
+
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -171,6 +171,18 @@ void test_func( ) {
 		  json_sv );
 
 		std::cout << "element count 2: " << count2 << '\n';
+
+		auto const count_into = *daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  "p2. float parsing into presized buffer", json_sv.size( ),
+		  [&]( std::string_view sv ) {
+			  auto const sz =
+			    from_json_array_into( data.data( ), data.size( ), sv );
+			  daw::do_not_optimize( data );
+			  return sz;
+		  },
+		  json_sv );
+
+		std::cout << "element count into: " << count_into << '\n';
 	}
 
 	std::cout << "Checked\n";
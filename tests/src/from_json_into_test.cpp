@@ -0,0 +1,267 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  This test checks that from_json_into refills the strings and containers of
+//  an existing value and benchmarks it against from_json
+//
+
+#include "defines.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstddef>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 100;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+struct IntList {
+	std::vector<int> items;
+	int refills = 0;
+
+	IntList( ) = default;
+
+	template<typename Iterator>
+	IntList( Iterator first, Iterator last )
+	  : items( first, last ) {}
+};
+
+struct Inner {
+	std::string name;
+	std::vector<double> values;
+};
+
+struct Message {
+	std::string id;
+	std::vector<int> numbers;
+	std::unordered_map<std::string, int> counts;
+	Inner inner;
+	std::optional<std::string> note;
+	IntList list;
+};
+
+// No to_json_data, so it is assigned instead
+struct Point {
+	int x;
+	int y;
+};
+
+// Only a const to_json_data, so it is assigned instead
+struct Label {
+	std::string text;
+};
+
+namespace daw::json {
+	template<>
+	struct reuse_constructor<IntList> {
+		template<typename Iterator>
+		void operator( )( IntList &list, Iterator first, Iterator last ) const {
+			list.items.assign( first, last );
+			++list.refills;
+		}
+	};
+
+	template<>
+	struct json_data_contract<Inner> {
+		static constexpr char const name[] = "name";
+		static constexpr char const values[] = "values";
+		using type = json_member_list<json_string<name>,
+		                              json_array<values, double>>;
+
+		static constexpr auto to_json_data( Inner const &v ) {
+			return std::forward_as_tuple( v.name, v.values );
+		}
+
+		// Used by from_json_into to fill the members in place
+		static constexpr auto to_json_data( Inner &v ) {
+			return std::forward_as_tuple( v.name, v.values );
+		}
+	};
+
+	template<>
+	struct json_data_contract<Message> {
+		static constexpr char const id[] = "id";
+		static constexpr char const numbers[] = "numbers";
+		static constexpr char const counts[] = "counts";
+		static constexpr char const inner[] = "inner";
+		static constexpr char const note[] = "note";
+		static constexpr char const list[] = "list";
+		using type = json_member_list<
+		  json_string<id>, json_array<numbers, int>,
+		  json_key_value<counts, std::unordered_map<std::string, int>, int>,
+		  json_class<inner, Inner>,
+		  json_string_null<note, std::optional<std::string>>,
+		  json_array<list, int, IntList>>;
+
+		static constexpr auto to_json_data( Message const &v ) {
+			return std::forward_as_tuple( v.id, v.numbers, v.counts, v.inner, v.note,
+			                              v.list );
+		}
+
+		static constexpr auto to_json_data( Message &v ) {
+			return std::forward_as_tuple( v.id, v.numbers, v.counts, v.inner, v.note,
+			                              v.list );
+		}
+	};
+
+	template<>
+	struct json_data_contract<Point> {
+		static constexpr char const x[] = "x";
+		static constexpr char const y[] = "y";
+		using type = json_member_list<json_number<x, int>, json_number<y, int>>;
+	};
+
+	template<>
+	struct json_data_contract<Label> {
+		static constexpr char const text[] = "text";
+		using type = json_member_list<json_string<text>>;
+
+		static constexpr auto to_json_data( Label const &v ) {
+			return std::forward_as_tuple( v.text );
+		}
+	};
+} // namespace daw::json
+
+namespace {
+	std::string make_message( std::size_t count, std::string_view id ) {
+		auto result = std::string( R"({"id":")" );
+		result += id;
+		result += R"(","numbers":[)";
+		for( std::size_t n = 0; n < count; ++n ) {
+			if( n > 0 ) {
+				result += ',';
+			}
+			result += std::to_string( n );
+		}
+		result += R"(],"counts":{"a":1,"b":2},)";
+		result += R"("inner":{"values":[1.5,2.5],)";
+		result += R"("name":"an inner name that is long"},)";
+		result += R"("list":[1,2,3]})";
+		return result;
+	}
+
+	void test_into( ) {
+		using namespace daw::json;
+		static_assert( json_details::can_parse_class_into<Message>( ) );
+		auto msg = Message{ };
+		from_json_into( msg, make_message( 100, "the first id, longer than sso" ) );
+		test_assert( msg.id == "the first id, longer than sso", "Unexpected id" );
+		test_assert( msg.numbers.size( ) == 100 and msg.numbers[99] == 99,
+		             "Unexpected numbers" );
+		test_assert( msg.counts.size( ) == 2 and msg.counts["b"] == 2,
+		             "Unexpected counts" );
+		test_assert( msg.inner.name == "an inner name that is long" and
+		               msg.inner.values.size( ) == 2,
+		             "Unexpected inner" );
+		test_assert( not msg.note, "Expected no note" );
+		test_assert( msg.list.items.size( ) == 3 and msg.list.refills == 1,
+		             "Expected the custom reuse_constructor to be used" );
+
+		auto const *id_data = msg.id.data( );
+		auto const *numbers_data = msg.numbers.data( );
+		auto const *values_data = msg.inner.values.data( );
+		auto const buckets = msg.counts.bucket_count( );
+		from_json_into( msg, make_message( 50, "second id, \\\"escaped\\\"" ) );
+		test_assert( msg.id == "second id, \"escaped\"", "Unexpected id" );
+		test_assert( msg.numbers.size( ) == 50 and msg.numbers[49] == 49,
+		             "Unexpected numbers" );
+		test_assert( msg.id.data( ) == id_data,
+		             "Expected the string to keep its buffer" );
+		test_assert( msg.numbers.data( ) == numbers_data and
+		               msg.inner.values.data( ) == values_data,
+		             "Expected the vectors to keep their buffers" );
+		test_assert( msg.counts.size( ) == 2 and
+		               msg.counts.bucket_count( ) == buckets,
+		             "Expected the map to keep its buckets" );
+		test_assert( msg.list.refills == 2, "Expected the list to be refilled" );
+
+		from_json_into( msg, std::string_view( R"({"id":"a","numbers":[],
+			"counts":{},"inner":{"name":"","values":[]},"note":"a note",
+			"list":[]})" ) );
+		test_assert( msg.numbers.empty( ) and msg.counts.empty( ) and
+		               msg.list.items.empty( ),
+		             "Expected empty containers" );
+		test_assert( msg.note and *msg.note == "a note", "Expected a note" );
+
+		auto pt = Point{ 1, 2 };
+		from_json_into( pt, std::string_view( R"({"y":4,"x":3})" ) );
+		test_assert( pt.x == 3 and pt.y == 4, "Unexpected point" );
+
+		static_assert( not json_details::can_parse_class_into<Label>( ) );
+		auto label = Label{ "a label" };
+		from_json_into( label, std::string_view( R"({"text":"another"})" ) );
+		test_assert( label.text == "another", "Unexpected label" );
+
+		auto counts = std::unordered_map<std::string, int>( );
+		from_json_into( counts, std::string_view( R"( {"a":1,"b":2})" ) );
+		test_assert( counts.size( ) == 2 and counts["a"] == 1,
+		             "Expected leading whitespace before a key value" );
+
+		auto numbers = std::vector<int>( );
+		numbers.reserve( 16 );
+		auto const *data = numbers.data( );
+		from_json_into( numbers, std::string_view( "[1,2,3]" ) );
+		test_assert( numbers.size( ) == 3 and numbers.data( ) == data,
+		             "Expected the top level vector to keep its buffer" );
+	}
+} // namespace
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	test_into( );
+
+	auto const json_data = make_message( 1000, "a message id" );
+	auto const json_sv = std::string_view( json_data );
+
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "from_json", json_sv.size( ),
+	  []( std::string_view sv ) {
+		  auto result = from_json<Message>( sv );
+		  daw::do_not_optimize( result );
+	  },
+	  json_sv );
+
+	auto msg = Message{ };
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "from_json_into", json_sv.size( ),
+	  [&msg]( std::string_view sv ) {
+		  from_json_into( msg, sv );
+		  daw::do_not_optimize( msg );
+	  },
+	  json_sv );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
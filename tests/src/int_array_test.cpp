@@ -172,6 +172,20 @@ void test_func( ) {
 
 		std::cout << "element count: " << count2 << '\n';
 
+		auto const count3 = *daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  "array of intmax_t: from_json_array_into presized buffer",
+		  json_sv_intmax.size( ),
+		  [&]( std::string_view sv ) {
+			  auto const sz = from_json_array_into(
+			    data.data( ), data.size( ), sv,
+			    options::parse_flags<options::CheckedParseMode::no> );
+			  daw::do_not_optimize( data );
+			  return sz;
+		  },
+		  json_sv_intmax );
+
+		std::cout << "element count: " << count3 << '\n';
+
 		{
 			auto to_json_str = std::string( );
 			to_json_str.resize(
@@ -0,0 +1,164 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  This checks the integer serializer against std::to_string for millions of
+//  random values and benchmarks it against the previous reverse based
+//  formatter.  int_output_test checks the edge cases
+//
+
+#include "defines.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/daw_random.h>
+#include <daw/json/daw_json_link.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 100;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+namespace {
+	// The formatter used prior to the forward writing one.  Digits are written
+	// back to front, reversed and then copied to the output
+	template<typename Integer>
+	void reverse_int_to_string( std::string &out, Integer value ) {
+		char buff[std::numeric_limits<Integer>::digits10 + 10]{ };
+		char *num_start = buff;
+		char *ptr = buff;
+		if constexpr( std::is_signed_v<Integer> ) {
+			if( value < 0 ) {
+				*ptr++ = '-';
+				++num_start;
+				auto const tmp = -static_cast<std::size_t>( value % 10 );
+				value /= -10;
+				*ptr++ = daw::json::json_details::digits100[tmp][0];
+				if( value == 0 ) {
+					out.append( buff, ptr );
+					return;
+				}
+			}
+		}
+		if( value == 0 ) {
+			*ptr++ = '0';
+		}
+		while( value >= 10 ) {
+			auto const tmp = static_cast<std::size_t>( value % 100 );
+			value /= 100;
+			ptr[0] = daw::json::json_details::digits100[tmp][0];
+			ptr[1] = daw::json::json_details::digits100[tmp][1];
+			ptr += 2;
+		}
+		if( value > 0 ) {
+			*ptr++ = static_cast<char>( '0' + static_cast<char>( value ) );
+		}
+		std::reverse( num_start, ptr );
+		out.append( buff, ptr );
+	}
+
+	template<typename Integer>
+	std::vector<Integer> make_random_data( std::size_t count ) {
+		auto result = std::vector<Integer>( );
+		result.reserve( count + 4 );
+		result.push_back( 0 );
+		result.push_back( daw::numeric_limits<Integer>::min( ) );
+		result.push_back( daw::numeric_limits<Integer>::max( ) );
+		for( std::size_t n = 0; n < count; ++n ) {
+			// Vary the magnitude so that all digit counts are exercised
+			auto const shift = daw::randint<int>( 0, 62 );
+			result.push_back( static_cast<Integer>(
+			  daw::randint<Integer>( daw::numeric_limits<Integer>::min( ),
+			                         daw::numeric_limits<Integer>::max( ) ) >>
+			  ( shift % std::numeric_limits<Integer>::digits ) ) );
+		}
+		return result;
+	}
+
+	template<typename Integer>
+	void test_integer( char const *type_name, std::size_t count ) {
+		using namespace daw::json;
+		std::cout << type_name << " test\n";
+		auto const data = make_random_data<Integer>( count );
+
+		std::string expected = "[";
+		for( auto const &v : data ) {
+			expected += std::to_string( v );
+			expected += ',';
+		}
+		expected.back( ) = ']';
+
+		std::string const json_data = to_json_array( data );
+		test_assert( json_data == expected,
+		             "Integer serialization does not match std::to_string" );
+
+		std::string legacy{ };
+		legacy.reserve( expected.size( ) );
+		(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  std::string( type_name ) + ": reverse formatter", expected.size( ),
+		  [&]( auto const &values ) {
+			  legacy.clear( );
+			  for( auto const &v : values ) {
+				  reverse_int_to_string( legacy, v );
+				  legacy.push_back( ',' );
+			  }
+			  daw::do_not_optimize( legacy );
+		  },
+		  data );
+
+		std::string current{ };
+		current.reserve( expected.size( ) );
+		(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  std::string( type_name ) + ": forward formatter", expected.size( ),
+		  [&]( auto const &values ) {
+			  current.clear( );
+			  auto out = serialization_policy<std::string>( current );
+			  for( auto const &v : values ) {
+				  out = utils::integer_to_string( out, v );
+				  out.put( ',' );
+			  }
+			  daw::do_not_optimize( current );
+		  },
+		  data );
+		test_assert( current == legacy,
+		             "Forward and reverse formatters produced different output" );
+	}
+} // namespace
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	constexpr std::size_t count = 1'000'000U;
+	test_integer<std::int32_t>( "int32_t", count );
+	test_integer<std::uint32_t>( "uint32_t", count );
+	test_integer<std::int64_t>( "int64_t", count );
+	test_integer<std::uint64_t>( "uint64_t", count );
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
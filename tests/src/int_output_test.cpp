@@ -0,0 +1,105 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  This test checks the integer serializer against std::to_string at every
+//  digit count boundary, the limits and some random values.
+//  int_output_bench checks millions of values and benchmarks
+//
+
+#include "defines.h"
+
+#include <daw/daw_random.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace {
+	template<typename Integer>
+	std::vector<Integer> make_edge_data( std::size_t random_count ) {
+		using limits = daw::numeric_limits<Integer>;
+		auto result = std::vector<Integer>( );
+		result.push_back( 0 );
+		result.push_back( limits::min( ) );
+		result.push_back( static_cast<Integer>( limits::min( ) + 1 ) );
+		result.push_back( limits::max( ) );
+		result.push_back( static_cast<Integer>( limits::max( ) - 1 ) );
+		// Each power of 10 and its neighbours, so that every digit count and
+		// the change between them is written
+		Integer p10 = 1;
+		while( true ) {
+			result.push_back( static_cast<Integer>( p10 - 1 ) );
+			result.push_back( p10 );
+			result.push_back( static_cast<Integer>( p10 + 1 ) );
+			if constexpr( std::is_signed_v<Integer> ) {
+				result.push_back( static_cast<Integer>( -p10 + 1 ) );
+				result.push_back( static_cast<Integer>( -p10 ) );
+				result.push_back( static_cast<Integer>( -p10 - 1 ) );
+			}
+			if( p10 > limits::max( ) / 10 ) {
+				break;
+			}
+			p10 *= 10;
+		}
+		for( std::size_t n = 0; n < random_count; ++n ) {
+			auto const shift = daw::randint<int>( 0, 62 );
+			result.push_back( static_cast<Integer>(
+			  daw::randint<Integer>( limits::min( ), limits::max( ) ) >>
+			  ( shift % std::numeric_limits<Integer>::digits ) ) );
+		}
+		return result;
+	}
+
+	template<typename Integer>
+	void test_integer( char const *type_name ) {
+		using namespace daw::json;
+		std::cout << type_name << " test\n";
+		auto const data = make_edge_data<Integer>( 1'000U );
+
+		std::string expected = "[";
+		for( auto const &v : data ) {
+			expected += std::to_string( v );
+			expected += ',';
+			test_assert( to_json( v ) == std::to_string( v ),
+			             "Integer serialization does not match std::to_string" );
+		}
+		expected.back( ) = ']';
+
+		std::string const json_data = to_json_array( data );
+		test_assert( json_data == expected,
+		             "Integer serialization does not match std::to_string" );
+	}
+} // namespace
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	test_integer<std::int32_t>( "int32_t" );
+	test_integer<std::uint32_t>( "uint32_t" );
+	test_integer<std::int64_t>( "int64_t" );
+	test_integer<std::uint64_t>( "uint64_t" );
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
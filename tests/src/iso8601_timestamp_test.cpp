@@ -0,0 +1,170 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  This test checks that the canonical ISO8601 layouts and the general parser
+//  agree, and benchmarks parsing arrays of timestamps in each
+//
+
+#include "defines.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/json/daw_json_link.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 100;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+namespace {
+	using timestamp_t =
+	  std::chrono::time_point<std::chrono::system_clock,
+	                          std::chrono::milliseconds>;
+	using date_array_t = daw::json::json_date_no_name<timestamp_t>;
+
+	timestamp_t parse( std::string_view ts ) {
+		return daw::json::datetime::parse_iso8601_timestamp(
+		  daw::string_view( ts.data( ), ts.size( ) ) );
+	}
+
+	static_assert( daw::json::datetime::parse_iso8601_timestamp(
+	                 daw::string_view( "1970-01-01T00:00:01.001Z" ) )
+	                 .time_since_epoch( )
+	                 .count( ) == 1001 );
+
+	void test_layouts( ) {
+		using namespace std::chrono;
+		auto const expected = daw::json::datetime::civil_to_time_point(
+		  2020, 1U, 2U, 1U, 34U, 34U, 443U );
+		test_assert( parse( "2020-01-02T01:34:34.443Z" ) == expected,
+		             "Unexpected canonical timestamp" );
+		// The general parser handles the other forms
+		test_assert( parse( "2020-01-02T01:34:34.443" ) == expected,
+		             "Unexpected timestamp without Z" );
+		test_assert( parse( "2020-01-02T01:34:34.443+00:00" ) == expected,
+		             "Unexpected timestamp with offset" );
+		test_assert( parse( "20200102T013434.443Z" ) == expected,
+		             "Unexpected basic format timestamp" );
+		test_assert( parse( "2020-01-02T02:34:34.443+01:00" ) == expected,
+		             "Unexpected timestamp with offset" );
+		test_assert( parse( "2020-01-02T01:34:34Z" ) ==
+		               expected - milliseconds( 443 ),
+		             "Unexpected timestamp without milliseconds" );
+		test_assert( parse( "2020-01-02T01:34:34" ) ==
+		               expected - milliseconds( 443 ),
+		             "Unexpected timestamp without Z" );
+	}
+
+	/// The canonical layouts must give the same result as the general parser,
+	/// which is used when the Z is replaced by +00:00
+	void test_random_timestamps( ) {
+		auto rnd = std::mt19937( 1234 );
+		char buff[64];
+		for( std::size_t n = 0; n < 100'000; ++n ) {
+			unsigned const year = rnd( ) % 10000U;
+			unsigned const month = 1U + rnd( ) % 12U;
+			unsigned const day = 1U + rnd( ) % 28U;
+			unsigned const hour = rnd( ) % 24U;
+			unsigned const minute = rnd( ) % 60U;
+			unsigned const second = rnd( ) % 60U;
+			unsigned const ms = rnd( ) % 1000U;
+			bool const has_ms = ( rnd( ) & 1U ) != 0;
+			auto const len =
+			  has_ms ? std::snprintf( buff, sizeof( buff ),
+			                          "%04u-%02u-%02uT%02u:%02u:%02u.%03u", year,
+			                          month, day, hour, minute, second, ms )
+			         : std::snprintf( buff, sizeof( buff ),
+			                          "%04u-%02u-%02uT%02u:%02u:%02u", year, month,
+			                          day, hour, minute, second );
+			auto const base = std::string( buff, static_cast<std::size_t>( len ) );
+			auto const canonical = parse( base + "Z" );
+			auto const general = parse( base + "+00:00" );
+			test_assert( canonical == general,
+			             "Expected the same result as the general parser" );
+		}
+	}
+
+	std::string make_timestamp_doc( std::size_t count, std::string_view zone ) {
+		auto rnd = std::mt19937( 42 );
+		std::string result = "[";
+		char buff[64];
+		for( std::size_t n = 0; n < count; ++n ) {
+			if( n > 0 ) {
+				result += ',';
+			}
+			std::snprintf( buff, sizeof( buff ),
+			               "\"%04u-%02u-%02uT%02u:%02u:%02u.%03u",
+			               1970U + rnd( ) % 100U, 1U + rnd( ) % 12U,
+			               1U + rnd( ) % 28U, rnd( ) % 24U, rnd( ) % 60U,
+			               rnd( ) % 60U, rnd( ) % 1000U );
+			result += buff;
+			result += zone;
+			result += '"';
+		}
+		result += ']';
+		return result;
+	}
+} // namespace
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	test_layouts( );
+	test_random_timestamps( );
+
+	using namespace daw::json;
+	constexpr std::size_t count = 100'000;
+	auto const canonical_doc = make_timestamp_doc( count, "Z" );
+	auto const offset_doc = make_timestamp_doc( count, "+00:00" );
+
+	auto canonical = std::vector<timestamp_t>( );
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "canonical timestamps", canonical_doc.size( ),
+	  [&]( std::string_view sv ) {
+		  canonical = from_json_array<date_array_t>( sv );
+		  daw::do_not_optimize( canonical );
+	  },
+	  std::string_view( canonical_doc ) );
+
+	auto offset = std::vector<timestamp_t>( );
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "timestamps with offset", offset_doc.size( ),
+	  [&]( std::string_view sv ) {
+		  offset = from_json_array<date_array_t>( sv );
+		  daw::do_not_optimize( offset );
+	  },
+	  std::string_view( offset_doc ) );
+	test_assert( canonical == offset, "Expected the same timestamps" );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
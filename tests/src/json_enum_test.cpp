@@ -0,0 +1,261 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  This test checks json_enum parsing and serializing, and benchmarks it
+//  against json_custom with to_string/from_string
+//
+
+#include "defines.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 100;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+namespace json_enum_test {
+	enum class Colours : std::uint8_t { red, green, blue, black, grey = 200 };
+
+	/// Names with explicit values far apart are looked up with a binary search
+	enum class Status : int {
+		pending = -1,
+		active = 10,
+		suspended = 1000,
+		closed = 100000
+	};
+
+	struct StatusNames {
+		static constexpr daw::json::json_enum_name<Status> values[] = {
+		  { Status::pending, "pending" },
+		  { Status::active, "active" },
+		  { Status::suspended, "suspended" },
+		  { Status::closed, "closed" } };
+	};
+
+	/// The linear to_string/from_string mapping json_enum replaces
+	constexpr std::string_view to_string( Colours c ) {
+		switch( c ) {
+		case Colours::red:
+			return "red";
+		case Colours::green:
+			return "green";
+		case Colours::blue:
+			return "blue";
+		case Colours::black:
+			return "black";
+		case Colours::grey:
+			return "grey";
+		}
+		std::terminate( );
+	}
+
+	constexpr Colours from_string( daw::tag_t<Colours>, std::string_view sv ) {
+		if( sv == "red" ) {
+			return Colours::red;
+		}
+		if( sv == "green" ) {
+			return Colours::green;
+		}
+		if( sv == "blue" ) {
+			return Colours::blue;
+		}
+		if( sv == "black" ) {
+			return Colours::black;
+		}
+		if( sv == "grey" or sv == "gray" ) {
+			return Colours::grey;
+		}
+		std::terminate( );
+	}
+
+	struct Item {
+		Colours colour;
+		Status status;
+		std::optional<Colours> trim;
+	};
+
+	bool operator==( Item const &lhs, Item const &rhs ) {
+		return lhs.colour == rhs.colour and lhs.status == rhs.status and
+		       lhs.trim == rhs.trim;
+	}
+} // namespace json_enum_test
+
+namespace daw::json {
+	template<>
+	struct json_enum_names<json_enum_test::Colours> {
+		using Colours = json_enum_test::Colours;
+		static constexpr json_enum_name<Colours> values[] = {
+		  { Colours::red, "red" },     { Colours::green, "green" },
+		  { Colours::blue, "blue" },   { Colours::black, "black" },
+		  { Colours::grey, "grey" },   { Colours::grey, "gray" } };
+	};
+
+	template<>
+	struct json_data_contract<json_enum_test::Item> {
+#ifdef DAW_JSON_CNTTP_JSON_NAME
+		using type = json_member_list<
+		  json_enum<"colour", json_enum_test::Colours>,
+		  json_enum<"status", json_enum_test::Status, json_enum_test::StatusNames>,
+		  json_enum_null<"trim", std::optional<json_enum_test::Colours>>>;
+#else
+		static constexpr char const colour[] = "colour";
+		static constexpr char const status[] = "status";
+		static constexpr char const trim[] = "trim";
+		using type = json_member_list<
+		  json_enum<colour, json_enum_test::Colours>,
+		  json_enum<status, json_enum_test::Status, json_enum_test::StatusNames>,
+		  json_enum_null<trim, std::optional<json_enum_test::Colours>>>;
+#endif
+		static inline auto to_json_data( json_enum_test::Item const &value ) {
+			return std::forward_as_tuple( value.colour, value.status, value.trim );
+		}
+	};
+} // namespace daw::json
+
+namespace json_enum_test {
+	using colour_t = daw::json::json_enum_no_name<Colours>;
+	using colour_custom_t = daw::json::json_custom_no_name<Colours>;
+
+	void test_item( ) {
+		using namespace daw::json;
+		constexpr std::string_view json_data =
+		  R"({"colour":"gray","status":"suspended","trim":"black"})";
+		auto const item = from_json<Item>( json_data );
+		test_assert( item.colour == Colours::grey, "Unexpected colour" );
+		test_assert( item.status == Status::suspended, "Unexpected status" );
+		test_assert( item.trim == Colours::black, "Unexpected trim" );
+
+		// The first name of a value is used when serializing
+		test_assert( to_json( item ) ==
+		               R"({"colour":"grey","status":"suspended","trim":"black"})",
+		             "Unexpected output" );
+		auto const no_trim = Item{ Colours::red, Status::pending, std::nullopt };
+		test_assert( from_json<Item>( to_json( no_trim ) ) == no_trim,
+		             "Expected the item to round trip" );
+	}
+
+	bool has_unknown_enum_error( std::string_view json_data ) {
+#ifdef DAW_USE_EXCEPTIONS
+		try {
+			(void)daw::json::from_json<colour_t>( json_data );
+		} catch( daw::json::json_exception const &jex ) {
+			return jex.reason_type( ) == daw::json::ErrorReason::UnknownEnumValue;
+		}
+		return false;
+#else
+		(void)json_data;
+		return true;
+#endif
+	}
+
+	void test_errors( ) {
+		test_assert( has_unknown_enum_error( R"("purple")" ),
+		             "Expected an unknown enum error" );
+		test_assert( has_unknown_enum_error( R"("re")" ),
+		             "Expected an unknown enum error" );
+		test_assert( has_unknown_enum_error( R"("")" ),
+		             "Expected an unknown enum error" );
+	}
+
+	std::vector<Colours> make_colours( std::size_t count ) {
+		constexpr Colours colours[] = { Colours::red, Colours::green,
+		                                Colours::blue, Colours::black,
+		                                Colours::grey };
+		auto rnd = std::mt19937( 42 );
+		auto result = std::vector<Colours>( count );
+		for( auto &c : result ) {
+			c = colours[rnd( ) % std::size( colours )];
+		}
+		return result;
+	}
+} // namespace json_enum_test
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace json_enum_test;
+	using namespace daw::json;
+	test_item( );
+	test_errors( );
+
+	auto const values = make_colours( 1'000'000 );
+	std::string const json_data = to_json_array<colour_t>( values );
+	test_assert( to_json_array<colour_custom_t>( values ) == json_data,
+	             "Expected the same output as to_string" );
+	auto const json_sv = std::string_view( json_data );
+
+	auto result = std::vector<Colours>( );
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "parse json_enum", json_sv.size( ),
+	  [&]( std::string_view sv ) {
+		  result = from_json_array<colour_t>( sv );
+		  daw::do_not_optimize( result );
+	  },
+	  json_sv );
+	test_assert( result == values, "Expected the values to round trip" );
+
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "parse from_string", json_sv.size( ),
+	  [&]( std::string_view sv ) {
+		  result = from_json_array<colour_custom_t>( sv );
+		  daw::do_not_optimize( result );
+	  },
+	  json_sv );
+	test_assert( result == values, "Expected the values to round trip" );
+
+	auto out = std::string( );
+	out.reserve( json_sv.size( ) );
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "serialize json_enum", json_sv.size( ),
+	  [&]( std::vector<Colours> const &v ) {
+		  out.clear( );
+		  (void)to_json_array<colour_t>( v, out );
+		  daw::do_not_optimize( out );
+	  },
+	  values );
+	test_assert( out == json_data, "Expected the same output" );
+
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "serialize to_string", json_sv.size( ),
+	  [&]( std::vector<Colours> const &v ) {
+		  out.clear( );
+		  (void)to_json_array<colour_custom_t>( v, out );
+		  daw::do_not_optimize( out );
+	  },
+	  values );
+	test_assert( out == json_data, "Expected the same output" );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
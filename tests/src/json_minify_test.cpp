@@ -0,0 +1,305 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  This test checks json_minify/json_reformat against to_json and benchmarks
+//  json_minify against minifying with the event parser
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_event_parser.h>
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_minify.h>
+
+#include <daw/daw_benchmark.h>
+#include <daw/daw_read_file.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 250;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+struct Point {
+	double x;
+	double y;
+};
+
+struct Shape {
+	std::string name;
+	std::vector<Point> points;
+	std::vector<int> empty;
+	bool closed;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Point> {
+		static constexpr char const x[] = "x";
+		static constexpr char const y[] = "y";
+		using type = json_member_list<json_number<x>, json_number<y>>;
+
+		static constexpr auto to_json_data( Point const &p ) {
+			return std::forward_as_tuple( p.x, p.y );
+		}
+	};
+
+	template<>
+	struct json_data_contract<Shape> {
+		static constexpr char const name[] = "name";
+		static constexpr char const points[] = "points";
+		static constexpr char const empty[] = "empty";
+		static constexpr char const closed[] = "closed";
+		using type = json_member_list<json_string<name>,
+		                              json_array<points, Point>,
+		                              json_array<empty, int>, json_bool<closed>>;
+
+		static constexpr auto to_json_data( Shape const &s ) {
+			return std::forward_as_tuple( s.name, s.points, s.empty, s.closed );
+		}
+	};
+} // namespace daw::json
+
+namespace {
+	// Minify through the event parser, as daw_json_minify does
+	class EventMinifyHandler {
+		std::vector<bool> is_first_stack{ };
+		std::vector<bool> is_class_stack{ };
+		std::string *out;
+
+	public:
+		explicit EventMinifyHandler( std::string &o )
+		  : out( &o ) {}
+
+		template<daw::json::json_options_t PolicyFlags, typename Allocator>
+		bool
+		handle_on_value( daw::json::basic_json_pair<PolicyFlags, Allocator> p ) {
+			if( is_first_stack.empty( ) ) {
+				is_first_stack.push_back( true );
+				is_class_stack.push_back( p.value.is_class( ) );
+			}
+			if( is_first_stack.back( ) ) {
+				is_first_stack.back( ) = false;
+			} else {
+				out->push_back( ',' );
+			}
+			if( is_class_stack.back( ) and p.name ) {
+				out->push_back( '"' );
+				out->append( p.name->data( ), p.name->size( ) );
+				out->append( "\":" );
+			}
+			auto const v_type = p.value.type( );
+			if( ( v_type == daw::json::JsonBaseParseTypes::Class ) |
+			    ( v_type == daw::json::JsonBaseParseTypes::Array ) ) {
+				return true;
+			}
+			auto const sv = p.value.get_string_view( );
+			out->append( sv.data( ), sv.size( ) );
+			return true;
+		}
+
+		template<daw::json::json_options_t PolicyFlags, typename Allocator>
+		bool handle_on_array_start(
+		  daw::json::basic_json_value<PolicyFlags, Allocator> ) {
+			is_first_stack.push_back( true );
+			is_class_stack.push_back( false );
+			out->push_back( '[' );
+			return true;
+		}
+
+		bool handle_on_array_end( ) {
+			is_first_stack.pop_back( );
+			is_class_stack.pop_back( );
+			out->push_back( ']' );
+			return true;
+		}
+
+		template<daw::json::json_options_t PolicyFlags, typename Allocator>
+		bool handle_on_class_start(
+		  daw::json::basic_json_value<PolicyFlags, Allocator> ) {
+			is_first_stack.push_back( true );
+			is_class_stack.push_back( true );
+			out->push_back( '{' );
+			return true;
+		}
+
+		bool handle_on_class_end( ) {
+			is_first_stack.pop_back( );
+			is_class_stack.pop_back( );
+			out->push_back( '}' );
+			return true;
+		}
+	};
+
+#if defined( DAW_USE_EXCEPTIONS )
+	bool is_error( std::string_view json_doc, daw::json::ErrorReason reason ) {
+		try {
+			(void)daw::json::json_minify( json_doc );
+		} catch( daw::json::json_exception const &jex ) {
+			return jex.reason_type( ) == reason;
+		}
+		return false;
+	}
+
+	void test_errors( ) {
+		using daw::json::ErrorReason;
+		test_assert( is_error( R"({"a":[1,2})", ErrorReason::InvalidBracketing ),
+		             "Expected an error on unbalanced brackets" );
+		test_assert( is_error( "[1}", ErrorReason::InvalidBracketing ),
+		             "Expected an error on mismatched brackets" );
+		test_assert( is_error( R"({"a":1])", ErrorReason::InvalidBracketing ),
+		             "Expected an error on mismatched brackets" );
+		test_assert( is_error( "[1:2]", ErrorReason::InvalidBracketing ),
+		             "Expected an error on a member name in an array" );
+		test_assert( is_error( "[1 2]", ErrorReason::ExpectedTokenNotFound ),
+		             "Expected an error on a missing comma" );
+		test_assert(
+		  is_error( R"(["a" "b"])", ErrorReason::ExpectedTokenNotFound ),
+		  "Expected an error on a missing comma" );
+		test_assert( is_error( R"({"a" 1})", ErrorReason::ExpectedTokenNotFound ),
+		             "Expected an error on a missing colon" );
+		test_assert( is_error( R"({"a":1 "b":2})",
+		                       ErrorReason::ExpectedTokenNotFound ),
+		             "Expected an error on a missing comma" );
+		test_assert( is_error( R"({"a":})", ErrorReason::ExpectedTokenNotFound ),
+		             "Expected an error on a missing value" );
+		test_assert( is_error( "{1:2}", ErrorReason::MissingMemberName ),
+		             "Expected an error on a missing member name" );
+		test_assert( is_error( "[1,]", ErrorReason::TrailingComma ),
+		             "Expected an error on a trailing comma" );
+		test_assert( is_error( R"("a" "b")", ErrorReason::InvalidEndOfValue ),
+		             "Expected an error on data after the root value" );
+	}
+#endif
+
+	void test_tokens( ) {
+		using namespace daw::json;
+		constexpr std::string_view json_doc =
+		  " {\n\t\"a\" : [ 1 , -2.5e3,true,  null , \"x\\\"y, [z]\" ] ,\r\n"
+		  "  \"b\" : { } , \"c\":[\n]}  ";
+		constexpr std::string_view expected =
+		  R"({"a":[1,-2.5e3,true,null,"x\"y, [z]"],"b":{},"c":[]})";
+		test_assert( json_minify( json_doc ) == expected, "Unexpected minify" );
+
+		char buff[128]{ };
+		char *last = json_minify( json_doc, static_cast<char *>( buff ) );
+		test_assert( std::string_view( buff, static_cast<std::size_t>(
+		                                       last - buff ) ) == expected,
+		             "Unexpected minify to pointer" );
+	}
+
+	void test_formats( ) {
+		using namespace daw::json;
+		auto const shape =
+		  Shape{ "tri", { { 0, 0 }, { 1.5, 0 }, { 0, -2 } }, { }, true };
+		std::string const minified = to_json( shape );
+		std::string const pretty = to_json(
+		  shape, options::output_flags<options::SerializationFormat::Pretty> );
+		std::string const pretty_tabs_crlf = to_json(
+		  shape, options::output_flags<options::SerializationFormat::Pretty,
+		                               options::IndentationType::Tab,
+		                               options::NewLineDelimiter::rn> );
+
+		test_assert( json_minify( pretty ) == minified,
+		             "Minifying pretty output does not match to_json" );
+		test_assert(
+		  json_reformat( minified,
+		                 options::output_flags<
+		                   options::SerializationFormat::Pretty> ) == pretty,
+		  "Reformatting does not match to_json" );
+		test_assert(
+		  json_reformat( pretty,
+		                 options::output_flags<options::SerializationFormat::Pretty,
+		                                       options::IndentationType::Tab,
+		                                       options::NewLineDelimiter::rn> ) ==
+		    pretty_tabs_crlf,
+		  "Reformatting does not match to_json" );
+	}
+
+	void bench_file( std::string_view json_data ) {
+		using namespace daw::json;
+		std::string event_result{ };
+		event_result.reserve( json_data.size( ) );
+		(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  "event parser minify", json_data.size( ),
+		  [&]( std::string_view sv ) {
+			  event_result.clear( );
+			  auto handler = EventMinifyHandler( event_result );
+			  json_event_parser( sv, handler );
+			  daw::do_not_optimize( event_result );
+		  },
+		  json_data );
+
+		std::string result{ };
+		result.reserve( json_data.size( ) );
+		(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  "json_minify", json_data.size( ),
+		  [&]( std::string_view sv ) {
+			  result.clear( );
+			  (void)json_minify( sv, result );
+			  daw::do_not_optimize( result );
+		  },
+		  json_data );
+		test_assert( result == event_result,
+		             "json_minify and the event parser disagree" );
+
+		std::string pretty{ };
+		pretty.reserve( json_data.size( ) * 2U );
+		(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  "json_reformat pretty", json_data.size( ),
+		  [&]( std::string_view sv ) {
+			  pretty.clear( );
+			  (void)json_reformat(
+			    sv, pretty,
+			    options::output_flags<options::SerializationFormat::Pretty> );
+			  daw::do_not_optimize( pretty );
+		  },
+		  json_data );
+		test_assert( json_minify( pretty ) == result,
+		             "Pretty output does not minify to the same document" );
+	}
+} // namespace
+
+int main( int argc, char **argv )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	test_tokens( );
+#if defined( DAW_USE_EXCEPTIONS )
+	test_errors( );
+#endif
+	test_formats( );
+	if( argc > 1 ) {
+		auto const json_data = *daw::read_file( argv[1] );
+		test_assert( not json_data.empty( ), "Could not open JSON document" );
+		bench_file( std::string_view( json_data.data( ), json_data.size( ) ) );
+	}
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
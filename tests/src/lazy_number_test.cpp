@@ -0,0 +1,268 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  This test checks that json_lazy_number defers conversion until the value
+//  is read, and benchmarks records where only one number is read
+//
+
+#include "defines.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 100;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+namespace lazy_number_test {
+	using daw::json::lazy_number;
+
+	struct Route {
+		std::uint64_t id;
+		lazy_number<double> latitude;
+		lazy_number<double> longitude;
+		lazy_number<std::int64_t> weight;
+		std::optional<lazy_number<double>> cost;
+	};
+
+	struct EagerRoute {
+		std::uint64_t id;
+		double latitude;
+		double longitude;
+		std::int64_t weight;
+		std::optional<double> cost;
+	};
+
+	using precise_flags_t =
+	  daw::json::options::parse_flags_t<daw::json::options::IEEE754Precise::yes>;
+
+	struct Reading {
+		lazy_number<double, precise_flags_t> value;
+		lazy_number<double> raw;
+	};
+
+	static_assert( daw::json::json_details::is_json_number( "-12.5e+3" ) );
+	static_assert( daw::json::json_details::is_json_number( "0" ) );
+	static_assert( not daw::json::json_details::is_json_number( "1." ) );
+	static_assert( not daw::json::json_details::is_json_number( ".5" ) );
+	static_assert( not daw::json::json_details::is_json_number( "1e" ) );
+	static_assert( not daw::json::json_details::is_json_number( "-" ) );
+	static_assert( not daw::json::json_details::is_json_number( "1-2" ) );
+} // namespace lazy_number_test
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<lazy_number_test::Route> {
+#ifdef DAW_JSON_CNTTP_JSON_NAME
+		using type =
+		  json_member_list<json_number<"id", std::uint64_t>,
+		                   json_lazy_number<"latitude">,
+		                   json_lazy_number<"longitude">,
+		                   json_lazy_number<"weight", std::int64_t>,
+		                   json_lazy_number_null<"cost">>;
+#else
+		static constexpr char const id[] = "id";
+		static constexpr char const latitude[] = "latitude";
+		static constexpr char const longitude[] = "longitude";
+		static constexpr char const weight[] = "weight";
+		static constexpr char const cost[] = "cost";
+		using type = json_member_list<json_number<id, std::uint64_t>,
+		                              json_lazy_number<latitude>,
+		                              json_lazy_number<longitude>,
+		                              json_lazy_number<weight, std::int64_t>,
+		                              json_lazy_number_null<cost>>;
+#endif
+		static inline auto to_json_data( lazy_number_test::Route const &value ) {
+			return std::forward_as_tuple( value.id, value.latitude,
+			                              value.longitude, value.weight,
+			                              value.cost );
+		}
+	};
+
+	template<>
+	struct json_data_contract<lazy_number_test::Reading> {
+		static constexpr char const value[] = "value";
+		static constexpr char const raw[] = "raw";
+		using type = json_member_list<
+		  json_lazy_number<value, double, true,
+		                   lazy_number_test::precise_flags_t>,
+		  json_lazy_number<raw, double, false>>;
+
+		static constexpr auto to_json_data( lazy_number_test::Reading const &v ) {
+			return std::forward_as_tuple( v.value, v.raw );
+		}
+	};
+
+	template<>
+	struct json_data_contract<lazy_number_test::EagerRoute> {
+#ifdef DAW_JSON_CNTTP_JSON_NAME
+		using type = json_member_list<
+		  json_number<"id", std::uint64_t>, json_number<"latitude">,
+		  json_number<"longitude">, json_number<"weight", std::int64_t>,
+		  json_number_null<"cost", std::optional<double>>>;
+#else
+		static constexpr char const id[] = "id";
+		static constexpr char const latitude[] = "latitude";
+		static constexpr char const longitude[] = "longitude";
+		static constexpr char const weight[] = "weight";
+		static constexpr char const cost[] = "cost";
+		using type = json_member_list<
+		  json_number<id, std::uint64_t>, json_number<latitude>,
+		  json_number<longitude>, json_number<weight, std::int64_t>,
+		  json_number_null<cost, std::optional<double>>>;
+#endif
+	};
+} // namespace daw::json
+
+namespace lazy_number_test {
+	void test_route( ) {
+		using namespace daw::json;
+		constexpr std::string_view json_data =
+		  R"({"id":7,"latitude":45.50,"longitude":-73.5670,"weight":12,)"
+		  R"("cost":1e3})";
+		auto const route = from_json<Route>( json_data );
+		test_assert( route.id == 7, "Unexpected id" );
+		test_assert( not route.latitude.is_converted( ) and
+		               not route.weight.is_converted( ),
+		             "Expected the numbers to not be converted yet" );
+		test_assert( route.latitude.text( ) == "45.50", "Unexpected text" );
+		test_assert( route.latitude.get( ) == 45.5, "Unexpected latitude" );
+		test_assert( route.latitude.is_converted( ),
+		             "Expected the value to be cached" );
+		test_assert( *route.weight == 12, "Unexpected weight" );
+		test_assert( route.cost and route.cost->get( ) == 1000.0,
+		             "Unexpected cost" );
+		test_assert( to_json( route ) == json_data,
+		             "Expected the original text to be written" );
+
+		auto const made = Route{ 1, 2.5, -0.25, 3, std::nullopt };
+		auto const made_json = to_json( made );
+		auto const parsed = from_json<Route>( made_json );
+		test_assert( parsed.latitude.get( ) == 2.5 and
+		               parsed.longitude.get( ) == -0.25 and
+		               parsed.weight.get( ) == 3 and not parsed.cost,
+		             "Expected values to round trip" );
+	}
+
+	void test_flags( ) {
+		using namespace daw::json;
+		// More digits than fit in 64 bits, the last ones decide the rounding
+		constexpr std::string_view json_data =
+		  R"({"value":2.47032822920623272088284396434110686182529901307162e-324,)"
+		  R"("raw":1})";
+		auto const reading = from_json<Reading>( json_data );
+		test_assert( reading.value.get( ) ==
+		               from_json<double>( reading.value.text( ),
+		                                  precise_flags_t{ } ),
+		             "Expected the value to be converted with the flags" );
+
+		// Without ValidateSyntax the text is checked before it is written
+		auto const bad = Reading{ 1.0, lazy_number<double>( "1." ) };
+		bool has_error = false;
+#if defined( DAW_USE_EXCEPTIONS )
+		try {
+			(void)to_json( bad );
+		} catch( json_exception const &jex ) {
+			has_error = jex.reason_type( ) == ErrorReason::InvalidNumber;
+		}
+#else
+		has_error = true;
+#endif
+		test_assert( has_error, "Expected invalid number text to be an error" );
+	}
+
+	std::string make_routes_doc( std::size_t count ) {
+		auto rnd = std::mt19937( 42 );
+		std::string result = "[";
+		char buff[256];
+		for( std::size_t n = 0; n < count; ++n ) {
+			if( n > 0 ) {
+				result += ',';
+			}
+			std::snprintf( buff, sizeof( buff ),
+			               R"({"id":%zu,"latitude":%.6f,"longitude":%.6f,)"
+			               R"("weight":%u,"cost":%.4e})",
+			               n, static_cast<double>( rnd( ) % 180'000'000U ) / 1e6,
+			               static_cast<double>( rnd( ) % 360'000'000U ) / 1e6,
+			               rnd( ) % 100000U,
+			               static_cast<double>( rnd( ) ) / 7.0 );
+			result += buff;
+		}
+		result += ']';
+		return result;
+	}
+} // namespace lazy_number_test
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace lazy_number_test;
+	using namespace daw::json;
+	test_route( );
+	test_flags( );
+
+	auto const json_data = make_routes_doc( 200'000 );
+	auto const json_sv = std::string_view( json_data );
+
+	std::int64_t lazy_sum = 0;
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "lazy numbers, read weight", json_sv.size( ),
+	  [&]( std::string_view sv ) {
+		  auto const routes = from_json_array<Route>( sv );
+		  lazy_sum = 0;
+		  for( auto const &r : routes ) {
+			  lazy_sum += r.weight.get( );
+		  }
+		  daw::do_not_optimize( lazy_sum );
+	  },
+	  json_sv );
+
+	std::int64_t eager_sum = 0;
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "eager numbers, read weight", json_sv.size( ),
+	  [&]( std::string_view sv ) {
+		  auto const routes = from_json_array<EagerRoute>( sv );
+		  eager_sum = 0;
+		  for( auto const &r : routes ) {
+			  eager_sum += r.weight;
+		  }
+		  daw::do_not_optimize( eager_sum );
+	  },
+	  json_sv );
+	test_assert( lazy_sum == eager_sum, "Expected the same sum" );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,173 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  This test checks that arrays of numbers parsed into std::vector and into
+//  caller owned buffers give the same result as the array iterator
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <list>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace number_array_test {
+	struct Series {
+		std::vector<double> values;
+		std::vector<std::int64_t> ids;
+	};
+} // namespace number_array_test
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<number_array_test::Series> {
+#ifdef DAW_JSON_CNTTP_JSON_NAME
+		using type = json_member_list<json_array<"values", double>,
+		                              json_array<"ids", std::int64_t>>;
+#else
+		static constexpr char const values[] = "values";
+		static constexpr char const ids[] = "ids";
+		using type = json_member_list<json_array<values, double>,
+		                              json_array<ids, std::int64_t>>;
+#endif
+	};
+} // namespace daw::json
+
+namespace number_array_test {
+	void test_vectors( ) {
+		using namespace daw::json;
+		test_assert( from_json_array<double>( std::string_view( "[]" ) ).empty( ),
+		             "Expected an empty array" );
+		test_assert(
+		  from_json_array<double>( std::string_view( "[ \n ]" ) ).empty( ),
+		  "Expected an empty array" );
+		auto const values =
+		  from_json_array<double>( std::string_view( "[ 1.5 ,-2,\n3e2 ] " ) );
+		test_assert( values == std::vector<double>{ 1.5, -2.0, 300.0 },
+		             "Unexpected values" );
+		auto const ints =
+		  from_json_array<std::uint32_t>( std::string_view( "[7]" ) );
+		test_assert( ints == std::vector<std::uint32_t>{ 7 }, "Unexpected value" );
+	}
+
+	void test_class_members( ) {
+		using namespace daw::json;
+		// ids comes before values in the document but after it in the member
+		// list, so ids is skipped and then parsed with known bounds, reserving
+		// from the comma count recorded by the skip
+		std::string json_data = R"({"ids":[0)";
+		for( std::int64_t n = 1; n < 100; ++n ) {
+			json_data += n % 3 == 0 ? " , " : ",";
+			json_data += std::to_string( n );
+		}
+		json_data += R"( ],"values":[0.25,1e1]})";
+		auto const series = from_json<Series>( json_data );
+		test_assert( series.values == std::vector<double>{ 0.25, 10.0 },
+		             "Unexpected values" );
+		test_assert( series.ids.size( ) == 100 and series.ids[99] == 99,
+		             "Unexpected ids" );
+		// Appending without the reserve, or with a wrong count, leaves spare
+		// capacity
+		test_assert( series.ids.capacity( ) == series.ids.size( ),
+		             "Expected the ids to be reserved from the skipped count" );
+	}
+
+	std::string make_doc( std::mt19937 &rnd, std::size_t count ) {
+		constexpr std::string_view whitespace[] = { "", "", " ", "\n  " };
+		std::string result = "[";
+		char buff[64];
+		for( std::size_t n = 0; n < count; ++n ) {
+			if( n > 0 ) {
+				result += whitespace[rnd( ) % 4U];
+				result += ',';
+			}
+			result += whitespace[rnd( ) % 4U];
+			std::snprintf( buff, sizeof( buff ), "%.17g",
+			               static_cast<double>( rnd( ) ) / 1e3 - 2e6 );
+			result += buff;
+		}
+		result += whitespace[rnd( ) % 4U];
+		result += ']';
+		return result;
+	}
+
+	void test_random_arrays( ) {
+		using namespace daw::json;
+		auto rnd = std::mt19937( 42 );
+		auto buffer = std::vector<double>( 300 );
+		for( std::size_t n = 0; n < 2'000; ++n ) {
+			auto const json_data = make_doc( rnd, rnd( ) % 300U );
+			auto const values = from_json_array<double>( json_data );
+			// std::list is built through the array iterator
+			auto const expected =
+			  from_json_array<double, std::list<double>>( json_data );
+			test_assert( values.size( ) == expected.size( ) and
+			               std::equal( values.begin( ), values.end( ),
+			                           expected.begin( ) ),
+			             "Expected the same values as the array iterator" );
+			auto const count =
+			  from_json_array_into( buffer.data( ), buffer.size( ), json_data );
+			test_assert( count == values.size( ) and
+			               std::equal( values.begin( ), values.end( ),
+			                           buffer.begin( ) ),
+			             "Expected the same values in the buffer" );
+		}
+	}
+
+	void test_buffer_capacity( ) {
+		using namespace daw::json;
+		std::int32_t buffer[3]{ };
+		auto const count =
+		  from_json_array_into( buffer, 3, std::string_view( "[1,2,3]" ) );
+		test_assert( count == 3 and buffer[2] == 3, "Unexpected buffer" );
+#if defined( DAW_USE_EXCEPTIONS )
+		bool has_error = false;
+		try {
+			(void)from_json_array_into( buffer, 3,
+			                            std::string_view( "[1,2,3,4]" ) );
+		} catch( json_exception const &jex ) {
+			has_error = jex.reason_type( ) == ErrorReason::ArrayCapacityExceeded;
+		}
+		test_assert( has_error, "Expected the capacity to be exceeded" );
+#endif
+	}
+} // namespace number_array_test
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace number_array_test;
+	test_vectors( );
+	test_class_members( );
+	test_random_arrays( );
+	test_buffer_capacity( );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,254 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  This test checks that IEEE754Precise parsing of float and double is
+//  correctly rounded by comparing it bit for bit with strtod/strtof, and
+//  benchmarks it against the default parsing
+//
+
+#include "defines.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 100;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+namespace {
+	constexpr auto precise_flags =
+	  daw::json::options::parse_flags<daw::json::options::IEEE754Precise::yes>;
+
+	// Eisel-Lemire and the big decimal fallback work in constant expressions.
+	// 1e23 is outside the exact fast path and 2^53 + 1 is half way, so it
+	// rounds to even
+	static_assert( daw::json::from_json<double>( std::string_view( "1e23" ),
+	                                             precise_flags ) == 1e23 );
+	static_assert( daw::json::from_json<double>(
+	                 std::string_view( "9007199254740993" ), precise_flags ) ==
+	               9007199254740992.0 );
+	// More than 19 digits.  The truncated significand is half way and one more
+	// than it is not, so the big decimal fallback decides
+	constexpr std::string_view above_halfway =
+	  "9007199254740993.0000000000000000000001";
+	static_assert( daw::json::from_json<double>( above_halfway,
+	                                             precise_flags ) ==
+	               9007199254740994.0 );
+	static_assert( daw::json::from_json<float>(
+	                 std::string_view( "1.00000005960464477550" ),
+	                 precise_flags ) == 1.00000005960464477550f );
+
+	template<typename Real>
+	bool is_same_bits( Real lhs, Real rhs ) {
+		return std::memcmp( &lhs, &rhs, sizeof( Real ) ) == 0;
+	}
+
+	template<typename Real>
+	Real parse_with_c_lib( std::string const &str ) {
+		if constexpr( std::is_same_v<Real, float> ) {
+			return std::strtof( str.c_str( ), nullptr );
+		} else {
+			return std::strtod( str.c_str( ), nullptr );
+		}
+	}
+
+	template<typename Real>
+	void check_real( std::string const &str ) {
+		Real const expected = parse_with_c_lib<Real>( str );
+		Real const result =
+		  daw::json::from_json<Real>( std::string_view( str ), precise_flags );
+		if( not is_same_bits( result, expected ) ) {
+			std::cerr << "Mismatch parsing '" << str << "'\n";
+		}
+		test_assert( is_same_bits( result, expected ),
+		             "Expected a correctly rounded result" );
+		// The same value when the end of the number is known up front
+		auto const arr = "[" + str + "]";
+		auto const values = daw::json::from_json<std::vector<Real>>(
+		  std::string_view( arr ), precise_flags );
+		test_assert( values.size( ) == 1 and is_same_bits( values[0], expected ),
+		             "Expected a correctly rounded array element" );
+	}
+
+	std::vector<std::string> const hard_values = {
+	  "0",
+	  "-0",
+	  "1",
+	  "0.1",
+	  "0.3",
+	  "1e23",
+	  "8.589973e9",
+	  "9007199254740993",
+	  "9007199254740992.9999999999999999999999",
+	  "1.7976931348623157e308",
+	  "1.7976931348623158e308",
+	  "1.7976931348623159e308",
+	  "2.2250738585072011e-308",
+	  "2.2250738585072014e-308",
+	  "4.9406564584124654e-324",
+	  "2.4703282292062327e-324",
+	  "2.4703282292062328e-324",
+	  "1e-400",
+	  "1e400",
+	  "3.4028234664e38",
+	  "3.4028235677973366e38",
+	  "1.17549435e-38",
+	  "1.4012984643e-45",
+	  "7.0064923216240854e-46",
+	  "2.6843546e8",
+	  "1.00000005960464477550",
+	  "1.0000000596046447755",
+	  "0.500000000000000166533453693773481063544750213623046875",
+	  "3.518437208883201171875e13",
+	  "7.4109846876186981626485318930233205854758970392148714663837852375101326"
+	  "090531312779794975454245398856969484704316857659638998506553390969459816"
+	  "219158455312200000000000000000000e-308",
+	  "2.2250738585072012e-308",
+	  "123456789012345678901234567890e-50",
+	  "0.000000000000000000000000000000000000000000000000000000000000001e300",
+	};
+
+	template<typename Real>
+	void test_hard_values( ) {
+		for( auto const &str : hard_values ) {
+			check_real<Real>( str );
+		}
+	}
+
+	/// Values at, or very close to, half way between two doubles
+	void test_halfway_values( ) {
+		auto rnd = std::mt19937_64( 0x5EED'5EED );
+		char buff[64];
+		for( std::size_t n = 0; n < 10'000; ++n ) {
+			auto const bits = rnd( ) & 0x7FEF'FFFF'FFFF'FFFFULL;
+			double d;
+			std::memcpy( &d, &bits, sizeof( double ) );
+			double const next = std::nextafter( d, 1e308 );
+			long double const mid =
+			  ( static_cast<long double>( d ) + static_cast<long double>( next ) ) /
+			  2.0L;
+			std::snprintf( buff, sizeof( buff ), "%.40Le", mid );
+			check_real<double>( buff );
+		}
+	}
+
+	template<typename Real, typename UInt>
+	void test_random_values( ) {
+		auto rnd = std::mt19937_64( 0xD0'0B1E );
+		char buff[64];
+		int const precision = std::is_same_v<Real, float> ? 9 : 17;
+		for( std::size_t n = 0; n < 100'000; ++n ) {
+			auto const bits = static_cast<UInt>( rnd( ) );
+			Real r;
+			std::memcpy( &r, &bits, sizeof( Real ) );
+			if( not std::isfinite( r ) ) {
+				continue;
+			}
+			std::snprintf( buff, sizeof( buff ), "%.*e", precision,
+			               static_cast<double>( r ) );
+			check_real<Real>( buff );
+			// Long mantissas are truncated and need the slow path
+			std::snprintf( buff, sizeof( buff ), "%.30e", static_cast<double>( r ) );
+			check_real<Real>( buff );
+		}
+	}
+
+	std::string make_large_exponent_doc( std::size_t count ) {
+		auto rnd = std::mt19937_64( 42 );
+		auto dist = std::uniform_int_distribution<int>( -300, 300 );
+		std::string result = "[";
+		char buff[64];
+		for( std::size_t n = 0; n < count; ++n ) {
+			if( n > 0 ) {
+				result += ',';
+			}
+			std::snprintf( buff, sizeof( buff ), "%llu.%llue%d",
+			               static_cast<unsigned long long>( rnd( ) >> 11U ),
+			               static_cast<unsigned long long>( rnd( ) >> 44U ),
+			               dist( rnd ) );
+			result += buff;
+		}
+		result += ']';
+		return result;
+	}
+} // namespace
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	test_hard_values<double>( );
+	test_hard_values<float>( );
+	test_halfway_values( );
+	test_random_values<double, std::uint64_t>( );
+	test_random_values<float, std::uint32_t>( );
+
+	using namespace daw::json;
+	auto const json_data = make_large_exponent_doc( 100'000 );
+	auto const json_sv = std::string_view( json_data );
+
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "double default", json_sv.size( ),
+	  []( std::string_view sv ) {
+		  auto result = from_json<std::vector<double>>( sv );
+		  daw::do_not_optimize( result );
+	  },
+	  json_sv );
+
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "double IEEE754Precise", json_sv.size( ),
+	  []( std::string_view sv ) {
+		  auto result = from_json<std::vector<double>>( sv, precise_flags );
+		  daw::do_not_optimize( result );
+	  },
+	  json_sv );
+
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "double strtod", json_sv.size( ),
+	  []( std::string_view sv ) {
+		  auto result = std::vector<double>( );
+		  char const *first = sv.data( ) + 1;
+		  while( *first != ']' ) {
+			  char *last = nullptr;
+			  result.push_back( std::strtod( first, &last ) );
+			  first = *last == ',' ? last + 1 : last;
+		  }
+		  daw::do_not_optimize( result );
+	  },
+	  json_sv );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,186 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  This test checks that options::PrecountArrays passes the element count of
+//  arrays and key/value maps to the container constructor, and that the size
+//  of a json_sized_array is limited before it is used to reserve
+//
+
+#include "defines.h"
+
+#include <daw/json/daw_json_link.h>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+struct counted_strings {
+	std::vector<std::string> values;
+	std::size_t size_hint;
+};
+
+struct counted_strings_constructor {
+	template<typename Iterator>
+	counted_strings operator( )( Iterator first, Iterator last ) const {
+		return { std::vector<std::string>( first, last ), 0 };
+	}
+
+	template<typename Iterator>
+	counted_strings operator( )( Iterator first, Iterator last,
+	                             std::size_t size_hint ) const {
+		auto result = counted_strings{ { }, size_hint };
+		result.values.reserve( size_hint );
+		result.values.assign( first, last );
+		return result;
+	}
+};
+
+struct counted_map : std::unordered_map<std::string, int> {
+	using std::unordered_map<std::string, int>::unordered_map;
+	std::size_t size_hint = 0;
+};
+
+struct counted_map_constructor {
+	template<typename Iterator>
+	counted_map operator( )( Iterator first, Iterator last ) const {
+		return counted_map( first, last );
+	}
+
+	template<typename Iterator>
+	counted_map operator( )( Iterator first, Iterator last,
+	                         std::size_t size_hint ) const {
+		auto result = counted_map( );
+		result.reserve( size_hint );
+		result.insert( first, last );
+		result.size_hint = size_hint;
+		return result;
+	}
+};
+
+struct Doc {
+	counted_strings names;
+	std::vector<std::vector<int>> nested;
+	counted_map kv;
+	counted_map kv_array;
+	std::unordered_map<std::string, int> kv_default;
+};
+
+struct Sized {
+	long long size;
+	std::vector<int> values;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Sized> {
+		static constexpr char const size[] = "size";
+		static constexpr char const values[] = "values";
+		using type =
+		  json_member_list<json_number<size, long long>,
+		                   json_sized_array<values, int,
+		                                    json_number<size, long long>>>;
+	};
+
+	template<>
+	struct json_data_contract<Doc> {
+		static constexpr char const names[] = "names";
+		static constexpr char const nested[] = "nested";
+		static constexpr char const kv[] = "kv";
+		static constexpr char const kv_array[] = "kv_array";
+		static constexpr char const kv_default[] = "kv_default";
+		using type = json_member_list<
+		  json_array<names, std::string, counted_strings,
+		             counted_strings_constructor>,
+		  json_array<nested, std::vector<int>>,
+		  json_key_value<kv, counted_map, int, std::string,
+		                 counted_map_constructor>,
+		  json_key_value_array<kv_array, counted_map, int, std::string,
+		                       counted_map_constructor>,
+		  json_key_value<kv_default, std::unordered_map<std::string, int>, int>>;
+	};
+} // namespace daw::json
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	constexpr std::string_view json_doc = R"json(
+{
+	"names": [ "a,b", "[c]", "d\"e,f", "{", "" ],
+	"nested": [ [1,2,3], [], [4,5] ],
+	"kv": { "a": 1, "b,c": 2, "d": 3 },
+	"kv_array": [ { "key": "a", "value": 1 }, { "key": "b", "value": 2 } ],
+	"kv_default": { "a": 1, "b": 2, "c": 3, "d": 4 }
+}
+)json";
+
+	auto const doc = from_json<Doc>(
+	  json_doc, options::parse_flags<options::PrecountArrays::yes> );
+	test_assert( doc.names.size_hint == 5, "Expected a size hint of 5" );
+	test_assert( doc.names.values.size( ) == 5, "Expected 5 names" );
+	test_assert( doc.names.values[2] == "d\"e,f", "Unexpected name" );
+	test_assert( doc.nested.size( ) == 3, "Expected 3 nested arrays" );
+	test_assert( doc.nested[0].capacity( ) == 3, "Expected an exact reserve" );
+	test_assert( doc.nested[1].empty( ), "Expected an empty array" );
+	test_assert( doc.kv.size_hint == 3 and doc.kv.size( ) == 3,
+	             "Expected a size hint of 3" );
+	test_assert( doc.kv.at( "b,c" ) == 2, "Unexpected kv value" );
+	test_assert( doc.kv_array.size_hint == 2 and doc.kv_array.size( ) == 2,
+	             "Expected a size hint of 2" );
+	test_assert( doc.kv_default.size( ) == 4, "Expected 4 members" );
+
+	auto const doc_default = from_json<Doc>( json_doc );
+	test_assert( doc_default.names.size_hint == 0 and
+	               doc_default.kv.size_hint == 0,
+	             "Expected no size hint without PrecountArrays" );
+
+	// Top level arrays do not have known bounds and are counted separately
+	auto const values = from_json<std::vector<double>>(
+	  "[1.5, 2, 3e1 , 4 ]", options::parse_flags<options::PrecountArrays::yes> );
+	test_assert( values.size( ) == 4 and values.capacity( ) == 4,
+	             "Expected an exact reserve" );
+	auto const empty_values = from_json<std::vector<double>>(
+	  "[ ]", options::parse_flags<options::PrecountArrays::yes> );
+	test_assert( empty_values.empty( ), "Expected an empty array" );
+
+	// The size of a json_sized_array is from the document, it cannot reserve
+	// more than the remaining input could hold
+	auto const sized = from_json<Sized>(
+	  R"({"size": 1000000000000000, "values": [1,2,3]})" );
+	test_assert( sized.values.size( ) == 3 and sized.values.capacity( ) < 64,
+	             "Expected the size hint to be limited by the input" );
+	bool has_error = false;
+#if defined( DAW_USE_EXCEPTIONS )
+	try {
+		(void)from_json<Sized>( R"({"size": -1, "values": [1,2,3]})" );
+	} catch( json_exception const &jex ) {
+		has_error = jex.reason_type( ) == ErrorReason::NumberOutOfRange;
+	}
+#else
+	has_error = true;
+#endif
+	test_assert( has_error, "Expected a negative size to be an error" );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
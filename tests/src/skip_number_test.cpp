@@ -0,0 +1,219 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  This test checks skip_number on digit runs that cross the 8 and 16
+//  character blocks, and benchmarks skipping unmapped numeric arrays
+//
+
+#include "defines.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 100;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+namespace skip_number_test {
+	struct Feature {
+		std::string name;
+		std::string bbox;
+	};
+
+	static_assert( daw::json::json_details::count_leading_digits8( "12345678" ) ==
+	               8 );
+	static_assert( daw::json::json_details::count_leading_digits8( "1234567:" ) ==
+	               7 );
+	static_assert( daw::json::json_details::count_leading_digits8( "/1234567" ) ==
+	               0 );
+	static_assert( daw::json::json_details::count_leading_digits8( "12.45678" ) ==
+	               2 );
+} // namespace skip_number_test
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<skip_number_test::Feature> {
+#ifdef DAW_JSON_CNTTP_JSON_NAME
+		using type =
+		  json_member_list<json_string<"name">, json_raw<"bbox", std::string>>;
+#else
+		static constexpr char const name[] = "name";
+		static constexpr char const bbox[] = "bbox";
+		using type =
+		  json_member_list<json_string<name>, json_raw<bbox, std::string>>;
+#endif
+	};
+} // namespace daw::json
+
+namespace skip_number_test {
+	std::string make_digits( std::mt19937 &rnd, std::size_t count ) {
+		auto result = std::string( );
+		for( std::size_t n = 0; n < count; ++n ) {
+			// Avoid a leading zero, it is not allowed before other digits
+			result += static_cast<char>( n == 0 ? '1' + rnd( ) % 9U
+			                                     : '0' + rnd( ) % 10U );
+		}
+		return result;
+	}
+
+	template<daw::json::options::ExecModeTypes ExecMode>
+	void test_skip_number( ) {
+		using namespace daw::json;
+		using namespace daw::json::json_details;
+		auto rnd = std::mt19937( 1234 );
+		constexpr std::string_view delimiters = ",]} \n";
+		for( std::size_t int_len = 1; int_len <= 40; ++int_len ) {
+			for( std::size_t frac_len = 0; frac_len <= 20; ++frac_len ) {
+				for( unsigned exp_kind = 0; exp_kind < 3; ++exp_kind ) {
+					auto number = make_digits( rnd, int_len );
+					std::size_t decimal_pos = std::string::npos;
+					if( frac_len > 0 ) {
+						decimal_pos = number.size( );
+						number += '.';
+						number += make_digits( rnd, frac_len );
+					}
+					std::size_t exp_pos = std::string::npos;
+					if( exp_kind > 0 ) {
+						exp_pos = number.size( );
+						number += exp_kind == 1 ? "e+" : "E-";
+						number += make_digits( rnd, 1U + rnd( ) % 3U );
+					}
+					auto const json_data =
+					  number + delimiters[rnd( ) % delimiters.size( )] + "1]";
+					auto parse_state = BasicParsePolicy<parse_options( ExecMode )>(
+					  std::data( json_data ), daw::data_end( json_data ) );
+					auto const result = skip_number( parse_state );
+					auto const *const first = std::data( json_data );
+					test_assert( result.last == first + number.size( ) and
+					               parse_state.first == result.last,
+					             "Expected the number to be skipped exactly" );
+					test_assert( decimal_pos == std::string::npos
+					               ? result.class_first == nullptr
+					               : result.class_first == first + decimal_pos,
+					             "Unexpected position of the decimal point" );
+					test_assert( exp_pos == std::string::npos
+					               ? result.class_last == nullptr
+					               : result.class_last == first + exp_pos,
+					             "Unexpected position of the exponent" );
+				}
+			}
+		}
+	}
+
+	std::string make_bbox( std::mt19937 &rnd, std::size_t count ) {
+		std::string result = "[";
+		char buff[64];
+		for( std::size_t n = 0; n < count; ++n ) {
+			if( n > 0 ) {
+				result += ',';
+			}
+			std::snprintf( buff, sizeof( buff ), "[%.15f,%.15f]",
+			               static_cast<double>( rnd( ) ) / 1e7 - 180.0,
+			               static_cast<double>( rnd( ) ) / 1e7 - 90.0 );
+			result += buff;
+		}
+		result += ']';
+		return result;
+	}
+
+	struct feature_doc {
+		std::string json_data;
+		std::vector<std::string> bboxes;
+	};
+
+	feature_doc make_feature_doc( std::size_t count ) {
+		auto rnd = std::mt19937( 42 );
+		auto result = feature_doc{ };
+		result.json_data = "[";
+		for( std::size_t n = 0; n < count; ++n ) {
+			if( n > 0 ) {
+				result.json_data += ',';
+			}
+			auto const bbox = make_bbox( rnd, 4 );
+			result.json_data += R"({"name":"feature)" + std::to_string( n ) +
+			                    R"(","coordinates":)" +
+			                    make_bbox( rnd, 64U + rnd( ) % 64U ) +
+			                    R"(,"bbox":)" + bbox + "}";
+			result.bboxes.push_back( bbox );
+		}
+		result.json_data += ']';
+		return result;
+	}
+
+	template<daw::json::options::ExecModeTypes ExecMode>
+	void bench_features( feature_doc const &doc ) {
+		using namespace daw::json;
+		auto const json_sv = std::string_view( doc.json_data );
+		auto features = std::vector<Feature>( );
+		(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+		  "skip unmapped coordinates", json_sv.size( ),
+		  [&]( std::string_view sv ) {
+			  features = from_json_array<Feature>(
+			    sv, options::parse_flags<ExecMode> );
+			  daw::do_not_optimize( features );
+		  },
+		  json_sv );
+		test_assert( features.size( ) == doc.bboxes.size( ),
+		             "Unexpected number of features" );
+		for( std::size_t n = 0; n < features.size( ); ++n ) {
+			test_assert( features[n].name == "feature" + std::to_string( n ),
+			             "Unexpected name" );
+			test_assert( features[n].bbox == doc.bboxes[n],
+			             "Expected the raw numeric array" );
+		}
+	}
+} // namespace skip_number_test
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace skip_number_test;
+	using daw::json::options::ExecModeTypes;
+	test_skip_number<ExecModeTypes::compile_time>( );
+	test_skip_number<ExecModeTypes::runtime>( );
+#if defined( DAW_ALLOW_SSE42 )
+	test_skip_number<ExecModeTypes::simd>( );
+#endif
+
+	auto const doc = make_feature_doc( 2'000 );
+	std::cout << "compile_time exec mode\n";
+	bench_features<ExecModeTypes::compile_time>( doc );
+#if defined( DAW_ALLOW_SSE42 )
+	std::cout << "simd exec mode\n";
+	bench_features<ExecModeTypes::simd>( doc );
+#endif
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,167 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  This test checks small_buffer_output and benchmarks serializing many small
+//  documents with to_json_small against to_json returning a std::string
+//
+
+#include "defines.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/daw_random.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 100;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+struct RpcResponse {
+	std::uint64_t request_id;
+	std::int32_t status;
+	std::string message;
+	std::vector<double> values;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<RpcResponse> {
+		static constexpr char const request_id[] = "request_id";
+		static constexpr char const status[] = "status";
+		static constexpr char const message[] = "message";
+		static constexpr char const values[] = "values";
+		using type = json_member_list<json_number<request_id, std::uint64_t>,
+		                              json_number<status, std::int32_t>,
+		                              json_string<message>,
+		                              json_array<values, double>>;
+
+		static constexpr auto to_json_data( RpcResponse const &v ) {
+			return std::forward_as_tuple( v.request_id, v.status, v.message,
+			                              v.values );
+		}
+	};
+} // namespace daw::json
+
+namespace {
+	std::string_view as_sv( daw::json::small_buffer_output<> const &out ) {
+		return std::string_view( out.data( ), out.size( ) );
+	}
+
+	std::vector<RpcResponse> make_responses( std::size_t count ) {
+		auto result = std::vector<RpcResponse>( );
+		result.reserve( count );
+		for( std::size_t n = 0; n < count; ++n ) {
+			auto values = std::vector<double>( daw::randint<std::size_t>( 0, 8 ) );
+			for( auto &v : values ) {
+				v = static_cast<double>( daw::randint<int>( -100'000, 100'000 ) ) /
+				    100.0;
+			}
+			result.push_back( RpcResponse{
+			  n, daw::randint<std::int32_t>( 0, 599 ),
+			  daw::randint<int>( 0, 1 ) == 0 ? "ok"
+			                                 : "request accepted for processing",
+			  std::move( values ) } );
+		}
+		return result;
+	}
+
+	void test_spill( ) {
+		using namespace daw::json;
+		auto const small_value = RpcResponse{ 1, 200, "ok", { 1.5, 2.5 } };
+		auto out = to_json_small( small_value );
+		test_assert( out.is_inline( ), "Expected small output to be inline" );
+		test_assert( as_sv( out ) == to_json( small_value ),
+		             "Unexpected small output" );
+
+		auto const large_value = RpcResponse{
+		  2, 500, std::string( 1000, 'x' ), std::vector<double>( 100, 0.5 ) };
+		std::string const large_json = to_json( large_value );
+		out = to_json_small( large_value );
+		test_assert( not out.is_inline( ), "Expected large output to spill" );
+		test_assert( as_sv( out ) == large_json, "Unexpected large output" );
+
+		// Copies and moves of both inline and heap buffers
+		auto copy = out;
+		test_assert( as_sv( copy ) == large_json, "Unexpected copy" );
+		auto moved = std::move( copy );
+		test_assert( as_sv( moved ) == large_json, "Unexpected move" );
+		auto inline_out = to_json_small( small_value );
+		moved = std::move( inline_out );
+		test_assert( moved.is_inline( ), "Expected inline after move" );
+		test_assert( as_sv( moved ) == to_json( small_value ),
+		             "Unexpected move assignment" );
+		moved = out;
+		test_assert( as_sv( moved ) == large_json, "Unexpected copy assignment" );
+
+		// Reusing the output keeps the capacity
+		out.clear( );
+		(void)to_json( large_value, out );
+		test_assert( as_sv( out ) == large_json, "Unexpected reused output" );
+	}
+} // namespace
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	test_spill( );
+
+	auto const responses = make_responses( 100'000 );
+	std::size_t total_size = 0;
+	for( auto const &r : responses ) {
+		auto const out = to_json_small( r );
+		test_assert( as_sv( out ) == to_json( r ), "Unexpected output" );
+		total_size += out.size( );
+	}
+
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "to_json std::string", total_size,
+	  []( auto const &values ) {
+		  for( auto const &v : values ) {
+			  auto result = to_json( v );
+			  daw::do_not_optimize( result );
+		  }
+	  },
+	  responses );
+
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "to_json_small", total_size,
+	  []( auto const &values ) {
+		  for( auto const &v : values ) {
+			  auto result = to_json_small( v );
+			  daw::do_not_optimize( result );
+		  }
+	  },
+	  responses );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
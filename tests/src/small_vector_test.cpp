@@ -0,0 +1,221 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  This test checks that short arrays parse into small_vector and
+//  static_vector without allocating, that static_vector reports overflow, and
+//  benchmarks them against std::vector
+//
+
+#include "defines.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/json/daw_json_link.h>
+#include <daw/json/daw_json_small_vector.h>
+
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 100;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+template<template<typename, std::size_t> typename Vector>
+struct Feature {
+	Vector<std::string, 4> tags;
+	Vector<double, 3> coords;
+};
+
+template<typename T, std::size_t>
+using std_vector = std::vector<T>;
+
+namespace daw::json {
+	template<template<typename, std::size_t> typename Vector>
+	struct json_data_contract<Feature<Vector>> {
+		static constexpr char const tags[] = "tags";
+		static constexpr char const coords[] = "coords";
+		using type =
+		  json_member_list<json_array<tags, std::string, Vector<std::string, 4>>,
+		                   json_array<coords, double, Vector<double, 3>>>;
+
+		static constexpr auto to_json_data( Feature<Vector> const &v ) {
+			return std::forward_as_tuple( v.tags, v.coords );
+		}
+	};
+} // namespace daw::json
+
+namespace {
+	bool copy_throws = false;
+
+	// Moving can throw, so growing copies and copying can be made to fail
+	struct Throwing {
+		int value;
+
+		explicit Throwing( int v )
+		  : value( v ) {}
+
+		Throwing( Throwing const &other )
+		  : value( other.value ) {
+#if defined( DAW_USE_EXCEPTIONS )
+			if( copy_throws ) {
+				throw std::runtime_error( "copy" );
+			}
+#endif
+		}
+
+		Throwing( Throwing &&other ) noexcept( false )
+		  : Throwing( static_cast<Throwing const &>( other ) ) {}
+
+		Throwing &operator=( Throwing const & ) = default;
+	};
+
+	constexpr std::string_view feature_doc =
+	  R"({"tags":["road","paved"],"coords":[1.5,2.5,3.5]})";
+
+	void test_small_vector( ) {
+		using namespace daw::json;
+		auto const f = from_json<Feature<small_vector>>( feature_doc );
+		test_assert( f.tags.size( ) == 2 and f.tags[1] == "paved",
+		             "Unexpected tags" );
+		test_assert( f.coords.size( ) == 3 and f.coords[2] == 3.5,
+		             "Unexpected coords" );
+		test_assert( f.tags.is_inline( ) and f.coords.is_inline( ),
+		             "Expected the elements to be stored inline" );
+
+		auto const g = from_json<Feature<small_vector>>(
+		  std::string_view( R"({"tags":["a","b","c","d","e"],"coords":[]})" ) );
+		test_assert( g.tags.size( ) == 5 and g.tags[4] == "e",
+		             "Expected the tags to spill to the heap" );
+		test_assert( not g.tags.is_inline( ) and g.coords.empty( ),
+		             "Unexpected storage" );
+
+		auto const f2 = from_json<Feature<small_vector>>( to_json( f ) );
+		test_assert( f2.tags == f.tags and f2.coords == f.coords,
+		             "Expected a round trip" );
+
+		auto const ints =
+		  from_json<small_vector<int, 4>>( std::string_view( "[1,2,3]" ) );
+		test_assert( ints.size( ) == 3 and ints.back( ) == 3,
+		             "Expected the container to be deduced" );
+	}
+
+	void test_growth( ) {
+		using namespace daw::json;
+		auto strs = small_vector<std::string, 2>{ "a string longer than sso",
+		                                          "another long string" };
+		// Appending an element of the vector itself when it has to grow
+		strs.push_back( strs[0] );
+		strs.emplace_back( strs[1] );
+		test_assert( strs.size( ) == 4 and strs[2] == strs[0] and
+		               strs[3] == strs[1] and not strs.is_inline( ),
+		             "Expected aliased elements to be appended" );
+
+#if defined( DAW_USE_EXCEPTIONS )
+		auto v = small_vector<Throwing, 2>( );
+		v.emplace_back( 1 );
+		v.emplace_back( 2 );
+		copy_throws = true;
+		bool has_error = false;
+		try {
+			v.emplace_back( 3 );
+		} catch( std::runtime_error const & ) {
+			has_error = true;
+		}
+		copy_throws = false;
+		test_assert( has_error, "Expected the copy to throw" );
+		test_assert( v.size( ) == 2 and v.is_inline( ) and v[0].value == 1 and
+		               v[1].value == 2,
+		             "Expected the vector to be unchanged by a failed grow" );
+#endif
+	}
+
+	void test_static_vector( ) {
+		using namespace daw::json;
+		auto const f = from_json<Feature<static_vector>>(
+		  feature_doc, options::parse_flags<options::PrecountArrays::yes> );
+		test_assert( f.coords.size( ) == 3 and f.coords[0] == 1.5,
+		             "Unexpected coords" );
+		test_assert( f.coords.capacity( ) == 3, "Unexpected capacity" );
+#if defined( DAW_USE_EXCEPTIONS )
+		bool has_error = false;
+		try {
+			(void)from_json<Feature<static_vector>>(
+			  std::string_view( R"({"tags":[],"coords":[1,2,3,4]})" ) );
+		} catch( daw::json::json_exception const &jex ) {
+			has_error = jex.reason_type( ) == ErrorReason::ArrayCapacityExceeded;
+		}
+		test_assert( has_error, "Expected the capacity to be exceeded" );
+#endif
+	}
+} // namespace
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	test_small_vector( );
+	test_growth( );
+	test_static_vector( );
+
+	auto json_data = std::string( "[" );
+	for( std::size_t n = 0; n < 10'000; ++n ) {
+		if( n > 0 ) {
+			json_data += ',';
+		}
+		json_data += feature_doc;
+	}
+	json_data += ']';
+	auto const json_sv = std::string_view( json_data );
+
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "std::vector", json_sv.size( ),
+	  []( std::string_view sv ) {
+		  auto result = from_json_array<Feature<std_vector>>( sv );
+		  daw::do_not_optimize( result );
+	  },
+	  json_sv );
+
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "small_vector", json_sv.size( ),
+	  []( std::string_view sv ) {
+		  auto result = from_json_array<Feature<small_vector>>( sv );
+		  daw::do_not_optimize( result );
+	  },
+	  json_sv );
+
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "static_vector", json_sv.size( ),
+	  []( std::string_view sv ) {
+		  auto result = from_json_array<Feature<static_vector>>( sv );
+		  daw::do_not_optimize( result );
+	  },
+	  json_sv );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,207 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  This test checks that interned_string members and keys are stored once in
+//  a string_pool and benchmarks parsing repetitive values to interned_string
+//  against std::string
+//
+
+#include "defines.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 100;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+struct LogEntry {
+	daw::json::interned_string host;
+	daw::json::interned_string status;
+	int code;
+	std::unordered_map<daw::json::interned_string, int> counts;
+};
+
+struct OwnedLogEntry {
+	std::string host;
+	std::string status;
+	int code;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<LogEntry> {
+		static constexpr char const host[] = "host";
+		static constexpr char const status[] = "status";
+		static constexpr char const code[] = "code";
+		static constexpr char const counts[] = "counts";
+		using type = json_member_list<
+		  json_string<host, interned_string>, json_string<status, interned_string>,
+		  json_number<code, int>,
+		  json_key_value<counts, std::unordered_map<interned_string, int>, int,
+		                 interned_string>>;
+	};
+
+	template<>
+	struct json_data_contract<OwnedLogEntry> {
+		static constexpr char const host[] = "host";
+		static constexpr char const status[] = "status";
+		static constexpr char const code[] = "code";
+		using type = json_member_list<json_string<host>, json_string<status>,
+		                              json_number<code, int>>;
+	};
+} // namespace daw::json
+
+namespace {
+	constexpr std::string_view json_doc = R"json(
+[
+	{ "host": "server-01.example.com", "status": "OK", "code": 200, "counts": { "GET": 1, "PUT": 2 } },
+	{ "host": "server-02.example.com", "status": "Not \"Found\"", "code": 404, "counts": { "GET": 3 } },
+	{ "host": "server-01.example.com", "status": "Not \"Found\"", "code": 404, "counts": { } },
+	{ "host": "", "status": "OK", "code": 200, "counts": { "PUT": 4 } }
+]
+)json";
+
+	void test_pool( ) {
+		using namespace daw::json;
+		auto pool = string_pool( );
+		auto const entries =
+		  from_json_interned<std::vector<LogEntry>>( json_doc, pool );
+		test_assert( entries.size( ) == 4, "Expected 4 entries" );
+		test_assert( entries[0].host == "server-01.example.com" and
+		               entries[0].status == "OK" and entries[0].code == 200,
+		             "Unexpected entry" );
+		test_assert( entries[1].status == "Not \"Found\"",
+		             "Expected the status to be unescaped" );
+		test_assert( entries[0].host.data( ) == entries[2].host.data( ),
+		             "Expected the hosts to share storage" );
+		test_assert( entries[1].status.data( ) == entries[2].status.data( ),
+		             "Expected the escaped statuses to share storage" );
+		test_assert( entries[0].status.data( ) == entries[3].status.data( ),
+		             "Expected the statuses to share storage" );
+		test_assert( entries[3].host.empty( ), "Expected an empty host" );
+
+		auto const pos = entries[1].counts.find( pool.intern( "GET" ) );
+		test_assert( pos != entries[1].counts.end( ) and pos->second == 3,
+		             "Expected the key to be found" );
+		test_assert( pos->first.data( ) ==
+		               entries[0].counts.find( pool.intern( "GET" ) )->first.data( ),
+		             "Expected the keys to share storage" );
+
+		// server-01, server-02, OK, Not "Found", GET and PUT
+		test_assert( pool.size( ) == 6, "Unexpected number of pooled strings" );
+		auto const bytes = pool.bytes_used( );
+		auto const entries2 =
+		  from_json_interned<std::vector<LogEntry>>( json_doc, pool );
+		test_assert( pool.size( ) == 6 and pool.bytes_used( ) == bytes,
+		             "Expected a second parse to reuse the pooled strings" );
+		test_assert( entries2[0].host.data( ) == entries[0].host.data( ),
+		             "Expected the hosts to share storage" );
+
+		// Grow past the initial table size
+		for( int n = 0; n < 5000; ++n ) {
+			(void)pool.intern( std::to_string( n ) );
+		}
+		test_assert( pool.size( ) == 5006, "Unexpected number of pooled strings" );
+		test_assert( pool.intern( "server-01.example.com" ).data( ) ==
+		               entries[0].host.data( ),
+		             "Expected the strings to survive growing the table" );
+		test_assert( pool.intern( "4999" ) == "4999", "Unexpected pooled string" );
+
+		pool.clear( );
+		test_assert( pool.size( ) == 0 and pool.bytes_used( ) == 0,
+		             "Expected an empty pool" );
+	}
+
+	std::string make_log( std::size_t count ) {
+		constexpr std::string_view hosts[] = {
+		  "server-01.example.com", "server-02.example.com",
+		  "server-03.example.com", "a-much-longer-host-name-04.example.com" };
+		constexpr std::string_view statuses[] = { "OK", "Not Found",
+		                                          "Internal Server Error" };
+		auto result = std::string( "[" );
+		for( std::size_t n = 0; n < count; ++n ) {
+			if( n > 0 ) {
+				result += ',';
+			}
+			result += R"({"host":")";
+			result += hosts[n % 4U];
+			result += R"(","status":")";
+			result += statuses[n % 3U];
+			result += R"(","code":200})";
+		}
+		result += ']';
+		return result;
+	}
+} // namespace
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	test_pool( );
+
+	auto const json_data = make_log( 100'000 );
+	auto const json_sv = std::string_view( json_data );
+	auto pool = string_pool( );
+	{
+		auto const expected = from_json<std::vector<OwnedLogEntry>>( json_sv );
+		auto const interned =
+		  from_json_interned<std::vector<LogEntry>>( json_sv, pool );
+		test_assert( expected.size( ) == interned.size( ), "Size mismatch" );
+		for( std::size_t n = 0; n < expected.size( ); ++n ) {
+			test_assert( interned[n].host == expected[n].host and
+			               interned[n].status == expected[n].status,
+			             "Value mismatch" );
+		}
+		test_assert( pool.size( ) == 7, "Unexpected number of pooled strings" );
+	}
+
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "std::string", json_sv.size( ),
+	  []( std::string_view sv ) {
+		  auto result = from_json<std::vector<OwnedLogEntry>>( sv );
+		  daw::do_not_optimize( result );
+	  },
+	  json_sv );
+
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "interned_string", json_sv.size( ),
+	  [&pool]( std::string_view sv ) {
+		  auto result = from_json_interned<std::vector<LogEntry>>( sv, pool );
+		  daw::do_not_optimize( result );
+	  },
+	  json_sv );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,165 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+
+#include "defines.h"
+
+#include <daw/daw_span.h>
+#include <daw/json/daw_json_link.h>
+
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+struct Tick {
+	std::uint32_t id;
+	std::int64_t price;
+	double qty;
+	bool is_bid;
+};
+
+struct Note {
+	std::uint32_t id;
+	std::string text;
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Tick> {
+		static constexpr char const id[] = "id";
+		static constexpr char const price[] = "price";
+		static constexpr char const qty[] = "qty";
+		static constexpr char const is_bid[] = "is_bid";
+		using type =
+		  json_member_list<json_number<id, std::uint32_t>,
+		                   json_number<price, std::int64_t>,
+		                   json_number<qty>, json_bool<is_bid>>;
+
+		static constexpr auto to_json_data( Tick const &v ) {
+			return std::forward_as_tuple( v.id, v.price, v.qty, v.is_bid );
+		}
+	};
+
+	template<>
+	struct json_data_contract<Note> {
+		static constexpr char const id[] = "id";
+		static constexpr char const text[] = "text";
+		using type = json_member_list<json_number<id, std::uint32_t>,
+		                              json_string<text>>;
+
+		static constexpr auto to_json_data( Note const &v ) {
+			return std::forward_as_tuple( v.id, v.text );
+		}
+	};
+} // namespace daw::json
+
+static_assert( daw::json::has_max_serialized_size_v<Tick> );
+static_assert( daw::json::has_max_serialized_size_v<std::int64_t> );
+static_assert( daw::json::max_serialized_size_v<bool> == 5 );
+static_assert( not daw::json::has_max_serialized_size_v<Note> );
+static_assert( not daw::json::has_max_serialized_size_v<
+               Tick, daw::json::options::output_flags_t<
+                       daw::json::options::SerializationFormat::Pretty>::value> );
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	auto const tick = Tick{ 4'294'967'295U, -9'223'372'036'854'775'807LL - 1,
+	                        -1.7976931348623157e308, true };
+	std::string const expected = to_json( tick );
+	test_assert( expected.size( ) <= max_serialized_size_v<Tick>,
+	             "Output exceeds the calculated maximum size" );
+
+	{
+		// Fits, uses the unchecked path
+		std::array<char, max_serialized_size_v<Tick>> buff{ };
+		auto const out = to_json_bounded( tick, buff.data( ), buff.size( ) );
+		test_assert( not out.truncated( ), "Unexpected truncation" );
+		test_assert( std::string_view( out.data( ), out.size( ) ) == expected,
+		             "Unexpected output" );
+	}
+	{
+		// Too small, the prefix is written and the needed size is reported
+		std::array<char, 16> buff{ };
+		auto const out = to_json_bounded( tick, buff.data( ), buff.size( ) );
+		test_assert( out.truncated( ), "Expected truncation" );
+		test_assert( out.size( ) == buff.size( ), "Expected a full buffer" );
+		test_assert( out.required_size( ) == expected.size( ),
+		             "Unexpected required size" );
+		test_assert( std::string_view( out.data( ), out.size( ) ) ==
+		               std::string_view( expected ).substr( 0, buff.size( ) ),
+		             "Unexpected output" );
+	}
+	{
+		// No known bound, the bounds checked path is always used
+		auto const note = Note{ 1, "hello world" };
+		std::string const note_json = to_json( note );
+		std::array<char, 64> buff{ };
+		auto out = to_json_bounded( note, buff.data( ), buff.size( ) );
+		test_assert( not out.truncated( ), "Unexpected truncation" );
+		test_assert( std::string_view( out.data( ), out.size( ) ) == note_json,
+		             "Unexpected output" );
+
+		out = to_json_bounded( note, buff.data( ), 4 );
+		test_assert( out.truncated( ), "Expected truncation" );
+		test_assert( out.required_size( ) == note_json.size( ),
+		             "Unexpected required size" );
+	}
+	{
+		// The span overload, with room to spare, an exact fit and one short
+		auto const note = Note{ 2, "a span" };
+		std::string const note_json = to_json( note );
+		char buff[64]{ };
+		auto out = to_json_bounded( note, daw::span( buff ) );
+		test_assert( not out.truncated( ) and out.data( ) == buff,
+		             "Unexpected truncation" );
+		test_assert( std::string_view( out.data( ), out.size( ) ) == note_json,
+		             "Unexpected output" );
+
+		out = to_json_bounded( note, daw::span( buff, note_json.size( ) ) );
+		test_assert( not out.truncated( ) and out.size( ) == note_json.size( ),
+		             "Expected an exact fit" );
+		test_assert( std::string_view( out.data( ), out.size( ) ) == note_json,
+		             "Unexpected output" );
+
+		out = to_json_bounded( note, daw::span( buff, note_json.size( ) - 1 ) );
+		test_assert( out.truncated( ) and out.size( ) == note_json.size( ) - 1,
+		             "Expected truncation" );
+		test_assert( out.required_size( ) == note_json.size( ),
+		             "Unexpected required size" );
+		test_assert( std::string_view( out.data( ), out.size( ) ) ==
+		               std::string_view( note_json ).substr( 0, out.size( ) ),
+		             "Unexpected output" );
+
+		// A type with a bound, through the unchecked path
+		char tick_buff[max_serialized_size_v<Tick>]{ };
+		auto const tick_out = to_json_bounded( tick, daw::span( tick_buff ) );
+		test_assert( not tick_out.truncated( ) and
+		               std::string_view( tick_out.data( ), tick_out.size( ) ) ==
+		                 expected,
+		             "Unexpected output" );
+	}
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif
@@ -0,0 +1,279 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/daw_json_link
+//
+//  This test checks options::UnescapeInPlace and benchmarks it against parsing
+//  escaped strings to std::string
+//
+
+#include "defines.h"
+
+#include <daw/daw_benchmark.h>
+#include <daw/json/daw_json_link.h>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#if not defined( DAW_NUM_RUNS )
+#if not defined( DEBUG ) or defined( NDEBUG )
+static inline constexpr std::size_t DAW_NUM_RUNS = 100;
+#else
+static inline constexpr std::size_t DAW_NUM_RUNS = 2;
+#endif
+#endif
+static_assert( DAW_NUM_RUNS > 0 );
+
+struct Message {
+	std::string_view user;
+	std::string_view text;
+	std::vector<std::string_view> tags;
+	daw::json::borrowed_string note;
+};
+
+struct OwnedMessage {
+	std::string user;
+	std::string text;
+};
+
+struct TaggedMessage {
+	daw::json::borrowed_string text;
+	std::variant<int, std::string> value;
+};
+
+// The same message as a JSON array, [text, value, type]
+struct TaggedTuple {
+	daw::json::borrowed_string text;
+	std::variant<int, std::string> value;
+	int type;
+};
+
+struct TaggedMessageSwitcher {
+	constexpr std::size_t operator( )( int type ) const {
+		return static_cast<std::size_t>( type );
+	}
+
+	int operator( )( TaggedMessage const &v ) const {
+		return static_cast<int>( v.value.index( ) );
+	}
+};
+
+namespace daw::json {
+	template<>
+	struct json_data_contract<Message> {
+		static constexpr char const user[] = "user";
+		static constexpr char const text[] = "text";
+		static constexpr char const tags[] = "tags";
+		static constexpr char const note[] = "note";
+		using type = json_member_list<
+		  json_string<user, std::string_view>, json_string<text, std::string_view>,
+		  json_array<tags, json_string_no_name<std::string_view>>,
+		  json_string<note, borrowed_string>>;
+	};
+
+	template<>
+	struct json_data_contract<OwnedMessage> {
+		static constexpr char const user[] = "user";
+		static constexpr char const text[] = "text";
+		using type = json_member_list<json_string<user>, json_string<text>>;
+	};
+
+	template<>
+	struct json_data_contract<TaggedMessage> {
+		static constexpr char const text[] = "text";
+		static constexpr char const value[] = "value";
+		static constexpr char const type_mem[] = "type";
+		using type = json_member_list<
+		  json_string<text, borrowed_string>,
+		  json_tagged_variant<value, std::variant<int, std::string>,
+		                      json_number<type_mem, int>, TaggedMessageSwitcher>>;
+	};
+
+	template<>
+	struct json_data_contract<TaggedTuple> {
+		using type = json_tuple_member_list<
+		  json_string_no_name<borrowed_string>,
+		  json_tagged_variant_no_name<std::variant<int, std::string>,
+		                              json_tuple_member<2, int>,
+		                              TaggedMessageSwitcher>,
+		  int>;
+	};
+} // namespace daw::json
+
+namespace {
+	using in_place_policy_t = daw::json::BasicParsePolicy<
+	  daw::json::options::parse_flags_t<
+	    daw::json::options::UnescapeInPlace::yes>::value>;
+
+	// The views into a temporary that owns the characters would dangle
+	static_assert( not daw::json::json_details::
+	                 is_valid_unescape_in_place_buffer_v<in_place_policy_t,
+	                                                     std::string> );
+	static_assert( not daw::json::json_details::
+	                 is_valid_unescape_in_place_buffer_v<in_place_policy_t,
+	                                                     std::vector<char>> );
+	static_assert(
+	  daw::json::json_details::is_valid_unescape_in_place_buffer_v<
+	    in_place_policy_t, std::vector<char> &> );
+
+	// std::string_view is deduced as a raw string
+	using escaped_views = daw::json::json_array_no_name<
+	  daw::json::json_string_no_name<std::string_view>>;
+
+	constexpr std::string_view json_doc = R"json(
+{
+	"user": "a user",
+	"text": "a \"quoted\" tab\t, ü and 🦄",
+	"tags": [ "plain", "escaped\\/", "" ],
+	"note": "new\nline"
+}
+)json";
+
+	bool is_in( std::string_view str, std::string const &buffer ) {
+		return str.data( ) >= buffer.data( ) and
+		       str.data( ) + str.size( ) <= buffer.data( ) + buffer.size( );
+	}
+
+	void test_in_place( ) {
+		using namespace daw::json;
+		auto buffer = std::string( json_doc );
+		auto const msg = from_json<Message>(
+		  buffer, options::parse_flags<options::UnescapeInPlace::yes> );
+		test_assert( msg.user == "a user", "Unexpected user" );
+		test_assert( msg.text ==
+		               "a \"quoted\" tab\t, \xC3\xBC and \xF0\x9F\xA6\x84",
+		             "Unexpected text" );
+		test_assert( is_in( msg.user, buffer ) and is_in( msg.text, buffer ),
+		             "Expected the strings to refer to the buffer" );
+		test_assert( msg.tags.size( ) == 3 and msg.tags[0] == "plain" and
+		               msg.tags[1] == "escaped\\/" and msg.tags[2].empty( ),
+		             "Unexpected tags" );
+		test_assert( is_in( msg.tags[1], buffer ),
+		             "Expected the tag to refer to the buffer" );
+		test_assert( msg.note == "new\nline" and msg.note.is_borrowed( ) and
+		               is_in( msg.note, buffer ),
+		             "Expected the note to be decoded in the buffer" );
+
+		// Without a mutable buffer the option is not used
+		auto const owned = from_json<OwnedMessage>(
+		  json_doc, options::parse_flags<options::UnescapeInPlace::yes> );
+		test_assert( owned.text == msg.text, "Unexpected text" );
+		test_assert( json_doc.find( "\\\"quoted" ) != std::string_view::npos,
+		             "Expected the document to be unchanged" );
+
+		auto in_place_buffer = std::string( json_doc );
+		auto const owned2 = from_json<OwnedMessage>(
+		  in_place_buffer, options::parse_flags<options::UnescapeInPlace::yes> );
+		test_assert( owned2.user == owned.user and owned2.text == owned.text,
+		             "Unexpected in place std::string" );
+	}
+
+	// The tag lookup scans the class again after text is parsed, a string
+	// decoded in place to a quote would end early
+	void test_rescanned_class( ) {
+		using namespace daw::json;
+		constexpr std::string_view tagged_doc =
+		  R"json({"text":"a \"quoted\" \\ text","value":"x\ty","type":1})json";
+		auto buffer = std::string( tagged_doc );
+		auto const msg = from_json<TaggedMessage>(
+		  buffer, options::parse_flags<options::UnescapeInPlace::yes> );
+		test_assert( msg.text == "a \"quoted\" \\ text", "Unexpected text" );
+		test_assert( msg.value.index( ) == 1 and
+		               std::get<1>( msg.value ) == "x\ty",
+		             "Unexpected value" );
+		test_assert( buffer == tagged_doc,
+		             "Expected the buffer to be unchanged" );
+	}
+
+	// The same for a tuple class, the tag is found by scanning the array again
+	// from the start
+	void test_rescanned_tuple( ) {
+		using namespace daw::json;
+		constexpr std::string_view tagged_doc =
+		  R"json(["a \"quoted\" \\ text","x\ty",1])json";
+		auto buffer = std::string( tagged_doc );
+		auto const msg = from_json<TaggedTuple>(
+		  buffer, options::parse_flags<options::UnescapeInPlace::yes> );
+		test_assert( msg.text == "a \"quoted\" \\ text", "Unexpected text" );
+		test_assert( msg.value.index( ) == 1 and
+		               std::get<1>( msg.value ) == "x\ty" and msg.type == 1,
+		             "Unexpected value" );
+		test_assert( buffer == tagged_doc,
+		             "Expected the buffer to be unchanged" );
+	}
+
+	std::string make_strings( std::size_t count ) {
+		auto result = std::string( "[" );
+		for( std::size_t n = 0; n < count; ++n ) {
+			if( n > 0 ) {
+				result += ',';
+			}
+			result += R"("a string with an \"escape\" in it and ü")";
+		}
+		result += ']';
+		return result;
+	}
+} // namespace
+
+int main( int, char ** )
+#ifdef DAW_USE_EXCEPTIONS
+  try
+#endif
+{
+	using namespace daw::json;
+	test_in_place( );
+	test_rescanned_class( );
+	test_rescanned_tuple( );
+
+	auto const json_data = make_strings( 100'000 );
+	auto const expected = from_json<std::vector<std::string>>( json_data );
+	{
+		auto buffer = json_data;
+		auto const in_place = from_json<escaped_views>(
+		  buffer, options::parse_flags<options::UnescapeInPlace::yes> );
+		test_assert( in_place.size( ) == expected.size( ), "Size mismatch" );
+		for( std::size_t n = 0; n < expected.size( ); ++n ) {
+			test_assert( in_place[n] == expected[n], "Value mismatch" );
+		}
+	}
+
+	// Both copy the document, as unescaping in place changes it
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "std::string", json_data.size( ),
+	  []( std::string const &sv ) {
+		  auto buffer = sv;
+		  auto result = from_json<std::vector<std::string>>( buffer );
+		  daw::do_not_optimize( result );
+	  },
+	  json_data );
+
+	(void)daw::bench_n_test_mbs<DAW_NUM_RUNS>(
+	  "std::string_view UnescapeInPlace", json_data.size( ),
+	  []( std::string const &sv ) {
+		  auto buffer = sv;
+		  auto result = from_json<escaped_views>(
+		    buffer, options::parse_flags<options::UnescapeInPlace::yes> );
+		  daw::do_not_optimize( result );
+	  },
+	  json_data );
+	std::cout << "done\n";
+}
+#ifdef DAW_USE_EXCEPTIONS
+catch( daw::json::json_exception const &jex ) {
+	std::cerr << "Exception thrown by parser: " << jex.reason( ) << '\n';
+	exit( 1 );
+} catch( std::exception const &ex ) {
+	std::cerr << "Unknown exception thrown during testing: " << ex.what( )
+	          << '\n';
+	exit( 1 );
+} catch( ... ) {
+	std::cerr << "Unknown exception thrown during testing\n";
+	throw;
+}
+#endif